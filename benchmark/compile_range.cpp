@@ -0,0 +1,34 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 - 2026 Daniil Goncharov <neargye@gmail.com>.
+
+// Reflects enums over [MAGIC_ENUM_RANGE_MIN, MAGIC_ENUM_RANGE_MAX] to measure compile time of values reflection.
+
+#include <magic_enum/magic_enum.hpp>
+
+enum class Sparse : int {
+  first = MAGIC_ENUM_RANGE_MIN,
+  minus_one = -1,
+  zero = 0,
+  one = 1,
+  last = MAGIC_ENUM_RANGE_MAX
+};
+
+enum Unscoped : long { A = MAGIC_ENUM_RANGE_MIN / 2, B, C = MAGIC_ENUM_RANGE_MAX / 2 };
+
+namespace ns {
+
+template <typename T>
+struct holder {
+  enum class nested : int { x = -7, y = 7 };
+};
+
+} // namespace ns
+
+static_assert(magic_enum::enum_count<Sparse>() == 5);
+static_assert(magic_enum::enum_values<Sparse>().front() == Sparse::first);
+static_assert(magic_enum::enum_values<Sparse>().back() == Sparse::last);
+static_assert(magic_enum::enum_count<Unscoped>() == 3);
+static_assert(magic_enum::enum_count<ns::holder<int>::nested>() == 2);
+
+int main() {}
@@ -0,0 +1,131 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 - 2026 Daniil Goncharov <neargye@gmail.com>.
+
+// Runtime microbenchmarks of lookups, prints average nanoseconds per call.
+
+#include <magic_enum/magic_enum.hpp>
+#include <magic_enum/magic_enum_containers.hpp>
+#include <magic_enum/magic_enum_flags.hpp>
+#include <magic_enum/magic_enum_switch.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+enum class Color { RED, GREEN, BLUE, CYAN, MAGENTA, YELLOW, BLACK, WHITE };
+
+enum class Sparse : int { a = -120, b = -77, c = -3, d = 0, e = 5, f = 42, g = 99, h = 120 };
+
+enum class Flags : std::uint32_t { A = 1 << 0, B = 1 << 3, C = 1 << 7, D = 1 << 12, E = 1 << 20 };
+template <>
+struct magic_enum::customize::enum_range<Flags> {
+  static constexpr bool is_flags = true;
+};
+
+namespace {
+
+constexpr std::size_t iterations = 1 << 22;
+
+template <typename T>
+void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const T* sink;
+  sink = &value;
+#endif
+}
+
+template <typename T, std::size_t N, typename F>
+void bench(const char* name, const std::array<T, N>& inputs, F&& f) {
+  for (std::size_t i = 0; i < N; ++i) {
+    do_not_optimize(f(inputs[i]));
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < iterations; ++i) {
+    do_not_optimize(f(inputs[i % N]));
+  }
+  const auto stop = std::chrono::steady_clock::now();
+
+  const auto ns = std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(iterations);
+  std::printf("%-36s %8.2f ns\n", name, ns);
+}
+
+// Shuffled inputs, so lookups do not hit the same entry in a row.
+template <typename T, std::size_t N>
+std::array<T, 4 * N> shuffled(const std::array<T, N>& values) {
+  std::array<T, 4 * N> inputs = {};
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    k = (k * 5 + 3) % N;
+    inputs[i] = values[k];
+  }
+  return inputs;
+}
+
+} // namespace
+
+int main() {
+  const auto colors = shuffled(magic_enum::enum_values<Color>());
+  const auto sparse = shuffled(magic_enum::enum_values<Sparse>());
+  const auto flags = shuffled(magic_enum::enum_values<Flags>());
+
+  std::array<std::string_view, colors.size()> color_names = {};
+  std::array<int, colors.size()> color_integers = {};
+  std::array<int, sparse.size()> sparse_integers = {};
+  std::array<std::string, flags.size()> flag_names = {};
+  std::array<Flags, flags.size()> flag_values = {};
+  for (std::size_t i = 0; i < colors.size(); ++i) {
+    color_names[i] = magic_enum::enum_name(colors[i]);
+    color_integers[i] = magic_enum::enum_integer(colors[i]);
+  }
+  for (std::size_t i = 0; i < sparse.size(); ++i) {
+    sparse_integers[i] = magic_enum::enum_integer(sparse[i]);
+  }
+  for (std::size_t i = 0; i < flags.size(); ++i) {
+    flag_values[i] = static_cast<Flags>(static_cast<std::uint32_t>(flags[i]) | static_cast<std::uint32_t>(flags[(i + 1) % flags.size()]));
+    flag_names[i] = magic_enum::enum_flags_name(flag_values[i]);
+  }
+
+  bench("enum_name(dense)", colors, [](Color c) { return magic_enum::enum_name(c); });
+  bench("enum_name(sparse)", sparse, [](Sparse s) { return magic_enum::enum_name(s); });
+  bench("enum_cast(string)", color_names, [](std::string_view n) { return magic_enum::enum_cast<Color>(n); });
+  bench("enum_cast(string, case_insensitive)", color_names, [](std::string_view n) { return magic_enum::enum_cast<Color>(n, magic_enum::case_insensitive); });
+  bench("enum_cast(integer, dense)", color_integers, [](int v) { return magic_enum::enum_cast<Color>(v); });
+  bench("enum_cast(integer, sparse)", sparse_integers, [](int v) { return magic_enum::enum_cast<Sparse>(v); });
+  bench("enum_index(sparse)", sparse, [](Sparse s) { return magic_enum::enum_index(s); });
+  bench("enum_flags_name", flag_values, [](Flags f) { return magic_enum::enum_flags_name(f).size(); });
+  bench("enum_flags_cast(string)", flag_names, [](const std::string& n) { return magic_enum::enum_flags_cast<Flags>(n); });
+  bench("enum_switch", sparse, [](Sparse s) {
+    return magic_enum::enum_switch([](auto v) { return static_cast<int>(magic_enum::enum_integer(v())); }, s, 0);
+  });
+
+  magic_enum::containers::array<Sparse, int> array = {};
+  bench("containers::array::operator[]", sparse, [&array](Sparse s) { return ++array[s]; });
+  magic_enum::containers::bitset<Sparse> bitset;
+  bench("containers::bitset::operator[]", sparse, [&bitset](Sparse s) {
+    bitset[s].flip();
+    return bitset.test(s);
+  });
+  magic_enum::containers::set<Sparse> set;
+  bench("containers::set::insert/erase", sparse, [&set](Sparse s) {
+    if (set.contains(s)) {
+      set.erase(s);
+    } else {
+      set.insert(s);
+    }
+    return set.size();
+  });
+  magic_enum::containers::map<Sparse, int> map;
+  bench("containers::map::operator[]/erase", sparse, [&map](Sparse s) {
+    if (++map[s] > 2) {
+      map.erase(s);
+    }
+    return map.size();
+  });
+}
@@ -46,6 +46,20 @@
 #  include <utility>
 #endif
 
+#if !defined(MAGIC_ENUM_USE_STD_MODULE) && __has_include(<bit>) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#  include <bit>
+#endif
+
+#if (!defined(__cpp_lib_bitops) || (__cpp_lib_bitops < 201907L)) && defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h>
+#  pragma intrinsic(_BitScanForward)
+#  pragma intrinsic(_BitScanReverse)
+#  ifdef _WIN64
+#    pragma intrinsic(_BitScanForward64)
+#    pragma intrinsic(_BitScanReverse64)
+#  endif
+#endif
+
 #if defined(MAGIC_ENUM_CONFIG_FILE)
 #  include MAGIC_ENUM_CONFIG_FILE
 #endif
@@ -69,6 +83,29 @@
 #  define MAGIC_ENUM_ASSERT(...) assert((__VA_ARGS__))
 #endif
 
+// Runtime value lookup of sparse enums uses SIMD compares, constant evaluation uses scalar search.
+// If need scalar lookup only, define the macro MAGIC_ENUM_NO_SIMD.
+#if defined(__cpp_lib_is_constant_evaluated) && __cpp_lib_is_constant_evaluated >= 201811L
+#  define MAGIC_ENUM_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__clang__) && defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define MAGIC_ENUM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  endif
+#elif defined(__GNUC__) && __GNUC__ >= 9 || defined(_MSC_VER) && _MSC_VER >= 1925
+#  define MAGIC_ENUM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if !defined(MAGIC_ENUM_NO_SIMD) && !defined(MAGIC_ENUM_USE_STD_MODULE) && defined(MAGIC_ENUM_IS_CONSTANT_EVALUATED)
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#    define MAGIC_ENUM_SIMD_AVX2 1
+#    define MAGIC_ENUM_SIMD_SSE2 1
+#  elif defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 2
+#    include <emmintrin.h>
+#    define MAGIC_ENUM_SIMD_SSE2 1
+#  endif
+#endif
+
 #if defined(__clang__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-warning-option"
@@ -110,6 +147,15 @@
 #  define MAGIC_ENUM_RANGE_MAX 127
 #endif
 
+// Sparse enum with span max - min + 1 less or equals than MAGIC_ENUM_INDEX_TABLE_MAX uses value to index table. By default MAGIC_ENUM_INDEX_TABLE_MAX = 1024.
+// If need another table size limit, redefine the macro MAGIC_ENUM_INDEX_TABLE_MAX, 0 disables tables.
+#if !defined(MAGIC_ENUM_INDEX_TABLE_MAX)
+#  define MAGIC_ENUM_INDEX_TABLE_MAX 1024
+#endif
+
+// Names of enum are stored in separate null-terminated string per value and array of string_view by default.
+// If need all names of enum in one contiguous pool with uint8_t/uint16_t offset table (smaller binary, cache-friendly name scans), define the macro MAGIC_ENUM_NAMES_POOL.
+
 // Improve ReSharper C++ intellisense performance with builtins, avoiding unnecessary template instantiations.
 #if defined(__RESHARPER__)
 #  undef MAGIC_ENUM_GET_ENUM_NAME_BUILTIN
@@ -123,6 +169,12 @@
 #  endif
 #endif
 
+// Enum values are reflected in chunks of 256 values per instantiation if compiler prints whole value pack in one signature (GCC).
+// If need one instantiation per value, define the macro MAGIC_ENUM_NO_BATCH_VALID.
+#if defined(__GNUC__) && !defined(__clang__) && !defined(MAGIC_ENUM_GET_ENUM_NAME_BUILTIN) && !defined(MAGIC_ENUM_NO_BATCH_VALID)
+#  define MAGIC_ENUM_BATCH_VALID 1
+#endif
+
 namespace magic_enum {
 
 // If need another optional type, define the macro MAGIC_ENUM_USING_ALIAS_OPTIONAL.
@@ -347,12 +399,12 @@ class static_str<0> {
   static constexpr char_type chars_[1] = {};
 };
 
+constexpr char_type to_lower(char_type c) noexcept {
+  return (c >= char_type{'A'} && c <= char_type{'Z'}) ? static_cast<char_type>(c + (char_type{'a'} - char_type{'A'})) : c;
+}
+
 template <typename Op = std::equal_to<>>
 class case_insensitive {
-  static constexpr char_type to_lower(char_type c) noexcept {
-    return (c >= char_type{'A'} && c <= char_type{'Z'}) ? static_cast<char_type>(c + (char_type{'a'} - char_type{'A'})) : c;
-  }
-
  public:
   template <typename L, typename R>
   constexpr auto operator()(L lhs, R rhs) const noexcept -> std::enable_if_t<std::is_same_v<std::decay_t<L>, char_type> && std::is_same_v<std::decay_t<R>, char_type>, bool> {
@@ -385,6 +437,9 @@ constexpr std::size_t find(string_view str, char_type c) noexcept {
 template <typename BinaryPredicate>
 inline constexpr bool is_default_predicate_v = std::is_same_v<std::decay_t<BinaryPredicate>, std::equal_to<string_view::value_type>> || std::is_same_v<std::decay_t<BinaryPredicate>, std::equal_to<>>;
 
+template <typename BinaryPredicate>
+inline constexpr bool is_case_insensitive_predicate_v = std::is_same_v<std::decay_t<BinaryPredicate>, case_insensitive<std::equal_to<string_view::value_type>>> || std::is_same_v<std::decay_t<BinaryPredicate>, case_insensitive<std::equal_to<>>>;
+
 template <typename BinaryPredicate>
 inline constexpr bool is_nothrow_invocable_v = is_default_predicate_v<BinaryPredicate> || std::is_nothrow_invocable_r_v<bool, BinaryPredicate&, char_type, char_type>;
 
@@ -437,6 +492,12 @@ constexpr bool cmp_less(L lhs, R rhs) noexcept {
   }
 }
 
+// Returns true if integer value is representable by integral type T.
+template <typename T, typename V>
+constexpr bool in_range(V value) noexcept {
+  return !cmp_less(value, (std::numeric_limits<T>::min)()) && !cmp_less((std::numeric_limits<T>::max)(), value);
+}
+
 template <typename T>
 constexpr T log2(T value) noexcept {
   static_assert(std::is_integral_v<T>, "magic_enum::detail::log2 requires integral type.");
@@ -451,6 +512,104 @@ constexpr T log2(T value) noexcept {
   }
 }
 
+template <typename T>
+constexpr std::size_t popcount(T x) noexcept {
+#if defined(__cpp_lib_bitops) && __cpp_lib_bitops >= 201907L
+  return static_cast<std::size_t>(std::popcount(x));
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__POPCNT__)
+  return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+  // Branch-free SWAR count, cost does not depend on number of set bits.
+  static_assert(std::is_unsigned_v<T> && sizeof(T) <= sizeof(std::uint64_t), "magic_enum::detail::popcount requires unsigned type.");
+  auto v = static_cast<std::uint64_t>(x);
+  v = v - ((v >> 1) & 0x5555555555555555ULL);
+  v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+  v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+  return static_cast<std::size_t>((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+template <typename T>
+constexpr int countr_zero(T x) noexcept {
+#if defined(__cpp_lib_bitops) && __cpp_lib_bitops >= 201907L
+  return std::countr_zero(x);
+#elif defined(_MSC_VER) && !defined(__clang__)
+#  if defined(MAGIC_ENUM_IS_CONSTANT_EVALUATED)
+  if (MAGIC_ENUM_IS_CONSTANT_EVALUATED()) { // _BitScanForward is not constexpr.
+    int c = 0;
+    for (; c < static_cast<int>(sizeof(T) * 8) && ((x >> c) & T{1}) == T{0}; ++c) {}
+    return c;
+  }
+#  endif
+  unsigned long index;
+  if constexpr (sizeof(T) <= sizeof(unsigned long)) {
+    return _BitScanForward(&index, static_cast<unsigned long>(x)) ? static_cast<int>(index) : static_cast<int>(sizeof(T) * 8);
+  } else {
+#  ifdef _WIN64
+    return _BitScanForward64(&index, static_cast<unsigned __int64>(x)) ? static_cast<int>(index) : static_cast<int>(sizeof(T) * 8);
+#  else
+    if (_BitScanForward(&index, static_cast<unsigned long>(x))) { return static_cast<int>(index); }
+    return _BitScanForward(&index, static_cast<unsigned long>(x >> 32)) ? static_cast<int>(index) + 32 : static_cast<int>(sizeof(T) * 8);
+#  endif
+  }
+#else
+  if constexpr (sizeof(T) <= sizeof(unsigned int)) {
+    return x ? __builtin_ctz(static_cast<unsigned int>(x)) : static_cast<int>(sizeof(T) * 8);
+  } else if constexpr (sizeof(T) <= sizeof(unsigned long)) {
+    return x ? __builtin_ctzl(static_cast<unsigned long>(x)) : static_cast<int>(sizeof(T) * 8);
+  } else {
+    return x ? __builtin_ctzll(static_cast<unsigned long long>(x)) : static_cast<int>(sizeof(T) * 8);
+  }
+#endif
+}
+
+template <typename T>
+constexpr int countl_zero(T x) noexcept {
+#if defined(__cpp_lib_bitops) && __cpp_lib_bitops >= 201907L
+  return std::countl_zero(x);
+#elif defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  if constexpr (sizeof(T) <= sizeof(unsigned long)) {
+    return _BitScanReverse(&index, static_cast<unsigned long>(x)) ? static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 1 : static_cast<int>(sizeof(T) * 8);
+  } else {
+#  ifdef _WIN64
+    return _BitScanReverse64(&index, static_cast<unsigned __int64>(x)) ? static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 1 : static_cast<int>(sizeof(T) * 8);
+#  else
+    if (_BitScanReverse(&index, static_cast<unsigned long>(x >> 32))) { return static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 33; }
+    return _BitScanReverse(&index, static_cast<unsigned long>(x)) ? static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 1 : static_cast<int>(sizeof(T) * 8);
+#  endif
+  }
+#else
+  // __builtin_clz* counts leading zeros in the promoted type width, not in T.
+  // We must subtract the extra bits introduced by zero-extension.
+  if constexpr (sizeof(T) <= sizeof(unsigned int)) {
+    return x ? __builtin_clz(static_cast<unsigned int>(x)) - static_cast<int>((sizeof(unsigned int) - sizeof(T)) * 8) : static_cast<int>(sizeof(T) * 8);
+  } else if constexpr (sizeof(T) <= sizeof(unsigned long)) {
+    return x ? __builtin_clzl(static_cast<unsigned long>(x)) - static_cast<int>((sizeof(unsigned long) - sizeof(T)) * 8) : static_cast<int>(sizeof(T) * 8);
+  } else {
+    return x ? __builtin_clzll(static_cast<unsigned long long>(x)) - static_cast<int>((sizeof(unsigned long long) - sizeof(T)) * 8) : static_cast<int>(sizeof(T) * 8);
+  }
+#endif
+}
+
+template <typename T>
+constexpr int bit_width(T x) noexcept {
+#if defined(__cpp_lib_int_pow2) && __cpp_lib_int_pow2 >= 202002L
+  return std::bit_width(x);
+#else
+  return std::numeric_limits<T>::digits - countl_zero(x);
+#endif
+}
+
+// True in constant evaluation, conservatively true if compiler cannot tell, so callers fall back to constexpr code.
+constexpr bool is_constant_evaluated() noexcept {
+#if defined(MAGIC_ENUM_IS_CONSTANT_EVALUATED)
+  return MAGIC_ENUM_IS_CONSTANT_EVALUATED();
+#else
+  return true;
+#endif
+}
+
 #if defined(__cpp_lib_array_constexpr) && __cpp_lib_array_constexpr >= 201603L
 #  define MAGIC_ENUM_ARRAY_CONSTEXPR 1
 #else
@@ -778,8 +937,84 @@ struct valid_count_t {
   }
 };
 
+#if defined(MAGIC_ENUM_BATCH_VALID)
+template <auto... V>
+constexpr auto MAGIC_ENUM_CALLING_CONVENTION n_batch() noexcept {
+  return str_view{__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1};
+}
+
+template <std::size_t N>
+struct valid_batch_t {
+  bool valid[N] = {};
+  std::size_t count = 0; // Number of values split from signature, N if it was parsed as expected.
+};
+
+// Splits "[with auto ...V = {(E)0, ns::E::A, ...}]" at top-level commas, value without name is printed as cast.
+// Character and string literals in type names, e.g. S<'('>::E::A, are skipped whole.
+template <std::size_t N>
+constexpr auto valid_batch(str_view name) noexcept {
+  valid_batch_t<N> vb;
+  std::size_t p = 0;
+  for (; p + 2 < name.size_; ++p) {
+    if (name.str_[p] == '=' && name.str_[p + 1] == ' ' && name.str_[p + 2] == '{') {
+      break;
+    }
+  }
+
+  std::size_t depth = 0;
+  bool first = true;
+  for (p += 3; p < name.size_ && vb.count < N; ++p) {
+    const auto c = name.str_[p];
+    if (first) {
+      if (c == ' ') {
+        continue;
+      }
+      vb.valid[vb.count] = c != '(';
+      first = false;
+    }
+    if (c == '\'' || c == '"') {
+      for (++p; p < name.size_ && name.str_[p] != c; ++p) {
+        if (name.str_[p] == '\\') {
+          ++p;
+        }
+      }
+    } else if (c == '(' || c == '<' || c == '[' || c == '{') {
+      ++depth;
+    } else if (depth > 0 && (c == ')' || c == '>' || c == ']' || c == '}')) {
+      --depth;
+    } else if (depth == 0 && (c == ',' || c == '}')) {
+      ++vb.count;
+      first = true;
+    }
+  }
+
+  return vb;
+}
+
+template <typename E, enum_subtype S, int Min, std::size_t J, std::size_t... I>
+constexpr auto valid_batch(std::index_sequence<I...>) noexcept {
+  if constexpr (supported<E>::value) {
+    return valid_batch<sizeof...(I)>(n_batch<value<E, Min, S>(J + I)...>());
+  } else {
+    valid_batch_t<sizeof...(I)> vb;
+    vb.count = sizeof...(I);
+    return vb;
+  }
+}
+
+template <typename E, enum_subtype S, int Min, std::size_t J, std::size_t N>
+constexpr bool has_empty_custom_name() noexcept {
+  for (std::size_t i = 0; i < N; ++i) {
+    if (const auto custom = customize::enum_name<E>(value<E, Min, S>(J + i)); custom.first == customize::detail::customize_tag::custom_tag && custom.second.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
 template <typename E, enum_subtype S, std::size_t Size, int Min, std::size_t J>
-constexpr void valid_count(valid_count_t<Size>& vc) noexcept {
+constexpr void valid_count_each(valid_count_t<Size>& vc) noexcept {
 #define MAGIC_ENUM_V(O)                                     \
   if constexpr ((J + O) < Size) {                           \
     if constexpr (is_valid<E, ualue<E, Min, S>(J + O)>()) { \
@@ -788,11 +1023,37 @@ constexpr void valid_count(valid_count_t<Size>& vc) noexcept {
   }
 
   MAGIC_ENUM_FOR_EACH_256(MAGIC_ENUM_V)
+#undef MAGIC_ENUM_V
+}
+
+template <typename E, enum_subtype S, std::size_t Size, int Min, std::size_t J>
+constexpr void valid_count(valid_count_t<Size>& vc) noexcept {
+#if defined(MAGIC_ENUM_BATCH_VALID)
+  constexpr auto n = (Size - J) < 256 ? (Size - J) : 256;
+  constexpr auto vb = valid_batch<E, S, Min, J>(std::make_index_sequence<n>{});
+  if constexpr (vb.count == n) {
+    static_assert(std::is_same_v<std::decay_t<decltype(customize::enum_name<E>(E{}))>, customize::customize_t>, "magic_enum::customize requires customize_t type.");
+    static_assert(!has_empty_custom_name<E, S, Min, J, n>(), "magic_enum::customize requires not empty string.");
+
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto custom = customize::enum_name<E>(value<E, Min, S>(J + i));
+      if (custom.first == customize::detail::customize_tag::custom_tag) {
+        vc.set(J + i);
+      } else if (custom.first == customize::detail::customize_tag::default_tag && vb.valid[i]) {
+        vc.set(J + i);
+      }
+    }
+  } else {
+    // Signature was not split into expected number of values, reflect each value on its own.
+    valid_count_each<E, S, Size, Min, J>(vc);
+  }
+#else
+  valid_count_each<E, S, Size, Min, J>(vc);
+#endif
 
   if constexpr ((J + 256) < Size) {
     valid_count<E, S, Size, Min, J + 256>(vc);
   }
-#undef MAGIC_ENUM_V
 }
 
 template <typename E, enum_subtype S, std::size_t Size, int Min>
@@ -889,21 +1150,80 @@ inline constexpr auto min_v = (count_v<E, S> > 0) ? static_cast<U>(values_v<E, S
 template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
 inline constexpr auto max_v = (count_v<E, S> > 0) ? static_cast<U>(values_v<E, S>.back()) : U{0};
 
+#if defined(MAGIC_ENUM_NAMES_POOL)
+template <typename E, enum_subtype S, std::size_t... J>
+constexpr std::size_t names_pool_size(std::index_sequence<J...>) noexcept {
+  return (std::size_t{0} + ... + (enum_name_v<E, values_v<E, S>[J]>.size() + 1));
+}
+
+// All names of enum in one pool, each name is null-terminated.
+template <typename E, enum_subtype S>
+struct names_pool_t {
+  static constexpr std::size_t count = count_v<E, S>;
+  static constexpr std::size_t size = names_pool_size<E, S>(std::make_index_sequence<count>{});
+  using offset_type = std::conditional_t<(size <= 0xFFU), std::uint8_t, std::conditional_t<(size <= 0xFFFFU), std::uint16_t, std::uint32_t>>;
+
+  char_type pool[size > 0 ? size : 1] = {};
+  // Name i is [pool + offsets[i], pool + offsets[i + 1] - 1).
+  offset_type offsets[count + 1] = {};
+
+  constexpr string_view operator[](std::size_t i) const noexcept {
+    return {pool + offsets[i], static_cast<std::size_t>(offsets[i + 1] - offsets[i] - 1)};
+  }
+};
+
+template <typename E, enum_subtype S, std::size_t... J>
+constexpr auto names_pool(std::index_sequence<J...>) noexcept {
+  constexpr string_view names[sizeof...(J) > 0 ? sizeof...(J) : 1] = {enum_name_v<E, values_v<E, S>[J]>.str()...};
+  names_pool_t<E, S> p{};
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < sizeof...(J); ++i) {
+    p.offsets[i] = static_cast<typename names_pool_t<E, S>::offset_type>(k);
+    for (const auto c : names[i]) {
+      p.pool[k++] = c;
+    }
+    p.pool[k++] = char_type{};
+  }
+  p.offsets[sizeof...(J)] = static_cast<typename names_pool_t<E, S>::offset_type>(k);
+
+  return p;
+}
+
+template <typename E, enum_subtype S>
+inline constexpr auto names_pool_v = names_pool<E, S>(std::make_index_sequence<count_v<E, S>>{});
+
+template <typename E, enum_subtype S, std::size_t... J>
+constexpr auto names(std::index_sequence<J...>) noexcept {
+  constexpr auto names = std::array<string_view, sizeof...(J)>{{names_pool_v<E, S>[J]...}};
+  return names;
+}
+#else
 template <typename E, enum_subtype S, std::size_t... J>
 constexpr auto names(std::index_sequence<J...>) noexcept {
   constexpr auto names = std::array<string_view, sizeof...(J)>{{enum_name_v<E, values_v<E, S>[J]>.str()...}};
   return names;
 }
+#endif
 
 template <typename E, enum_subtype S>
 inline constexpr auto names_v = names<E, S>(std::make_index_sequence<count_v<E, S>>{});
 
+// Returns name of value with index i, runtime lookups use it instead of names_v.
+template <typename E, enum_subtype S>
+constexpr string_view name_at(std::size_t i) noexcept {
+#if defined(MAGIC_ENUM_NAMES_POOL)
+  return names_pool_v<E, S>[i];
+#else
+  return names_v<E, S>[i];
+#endif
+}
+
 template <typename E, enum_subtype S, typename D = std::decay_t<E>>
 using names_t = decltype((names_v<D, S>));
 
 template <typename E, enum_subtype S, std::size_t... J>
 constexpr auto entries(std::index_sequence<J...>) noexcept {
-  constexpr auto entries = std::array<std::pair<E, string_view>, sizeof...(J)>{{{values_v<E, S>[J], enum_name_v<E, values_v<E, S>[J]>.str()}...}};
+  constexpr auto entries = std::array<std::pair<E, string_view>, sizeof...(J)>{{{values_v<E, S>[J], names_v<E, S>[J]}...}};
   return entries;
 }
 
@@ -931,6 +1251,373 @@ constexpr bool is_sparse() noexcept {
 template <typename E, enum_subtype S = subtype_v<E>>
 inline constexpr bool is_sparse_v = is_sparse<E, S>();
 
+enum class name_hash_mode : std::uint8_t {
+  none, // Perfect hash not found, names are searched linearly.
+  fast, // Hash of length, first, middle and last characters.
+  full  // Hash of all characters.
+};
+
+constexpr std::uint32_t name_hash_mix(std::uint32_t h) noexcept {
+  h ^= h >> 16;
+  h *= 0x7feb352dU;
+  h ^= h >> 15;
+  h *= 0x846ca68bU;
+  h ^= h >> 16;
+  return h;
+}
+
+template <bool CaseInsensitive>
+constexpr std::uint32_t hash_name(string_view value, name_hash_mode mode, std::uint32_t seed) noexcept {
+  auto h = seed ^ static_cast<std::uint32_t>(value.size());
+  const auto step = [&h](char_type c) {
+    if constexpr (CaseInsensitive) {
+      c = to_lower(c);
+    }
+    h = (h ^ static_cast<std::uint32_t>(c)) * 0x01000193U;
+  };
+
+  if (mode == name_hash_mode::fast) {
+    step(value[0]);
+    step(value[value.size() / 2]);
+    step(value[value.size() - 1]);
+  } else {
+    for (const auto c : value) {
+      step(c);
+    }
+  }
+
+  return name_hash_mix(h);
+}
+
+constexpr std::uint32_t name_hash_slot(std::uint32_t h, std::uint16_t displacement) noexcept {
+  return name_hash_mix(h + (static_cast<std::uint32_t>(displacement) + 1U) * 0x9e3779b9U);
+}
+
+// Minimal perfect hash of enum names (hash and displace): name hash selects bucket, bucket displacement selects slot, slot stores index + 1.
+// Case insensitive hash folds ASCII case, names which differ only in case are not separable.
+template <std::size_t N, bool CaseInsensitive>
+struct name_hash_t {
+  static constexpr std::size_t slots = [] {
+    std::size_t s = 1;
+    while (s < N) {
+      s <<= 1;
+    }
+    return (N * 4 > s * 3) ? s << 1 : s;
+  }();
+  static constexpr std::size_t buckets = (slots >= 4) ? slots / 4 : 1;
+
+  using index_type = std::conditional_t<(N < (std::numeric_limits<std::uint8_t>::max)()), std::uint8_t, std::uint16_t>;
+
+  name_hash_mode mode = name_hash_mode::none;
+  std::uint32_t seed = 0;
+  std::uint16_t displacements[buckets] = {};
+  index_type indices[slots] = {};
+
+  constexpr bool build(const std::array<string_view, N>& names, name_hash_mode m, std::uint32_t s) noexcept {
+    std::uint32_t hashes[N] = {};
+    std::size_t offsets[buckets + 1] = {};
+    std::size_t order[N] = {};
+
+    for (std::size_t i = 0; i < N; ++i) {
+      hashes[i] = hash_name<CaseInsensitive>(names[i], m, s);
+      ++offsets[(hashes[i] & (buckets - 1)) + 1];
+    }
+    std::size_t max_bucket_size = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+      if (offsets[b + 1] > max_bucket_size) {
+        max_bucket_size = offsets[b + 1];
+      }
+      offsets[b + 1] += offsets[b];
+    }
+    {
+      std::size_t fill[buckets] = {};
+      for (std::size_t i = 0; i < N; ++i) {
+        const auto b = hashes[i] & (buckets - 1);
+        order[offsets[b] + fill[b]++] = i;
+      }
+    }
+
+    for (auto& i : indices) {
+      i = 0;
+    }
+    // Place largest buckets first, so that the small ones fill the remaining gaps.
+    for (auto size = max_bucket_size; size > 0; --size) {
+      for (std::size_t b = 0; b < buckets; ++b) {
+        const auto first = offsets[b];
+        if (offsets[b + 1] - first != size) {
+          continue;
+        }
+        for (std::size_t i = first; i < first + size; ++i) {
+          for (std::size_t j = first; j < i; ++j) {
+            if (hashes[order[i]] == hashes[order[j]]) {
+              return false; // Names not separable with this hash.
+            }
+          }
+        }
+
+        bool placed = false;
+        for (std::uint32_t d = 0; !placed && d <= (std::numeric_limits<std::uint16_t>::max)(); ++d) {
+          std::size_t i = first;
+          for (; i < first + size; ++i) {
+            auto& slot = indices[name_hash_slot(hashes[order[i]], static_cast<std::uint16_t>(d)) & (slots - 1)];
+            if (slot != 0) {
+              break;
+            }
+            slot = static_cast<index_type>(order[i] + 1);
+          }
+          if (i == first + size) {
+            displacements[b] = static_cast<std::uint16_t>(d);
+            placed = true;
+          } else {
+            while (i-- > first) {
+              indices[name_hash_slot(hashes[order[i]], static_cast<std::uint16_t>(d)) & (slots - 1)] = 0;
+            }
+          }
+        }
+        if (!placed) {
+          return false;
+        }
+      }
+    }
+
+    mode = m;
+    seed = s;
+    return true;
+  }
+
+  constexpr std::size_t find(string_view value) const noexcept {
+    const auto h = hash_name<CaseInsensitive>(value, mode, seed);
+    const auto d = displacements[h & (buckets - 1)];
+
+    return indices[name_hash_slot(h, d) & (slots - 1)];
+  }
+};
+
+template <typename E, enum_subtype S, bool CaseInsensitive>
+constexpr auto name_hash() noexcept {
+  constexpr auto& names = names_v<E, S>;
+  name_hash_t<names.size(), CaseInsensitive> h;
+
+  if constexpr (names.size() > 0) {
+    constexpr name_hash_mode modes[] = {name_hash_mode::fast, name_hash_mode::full};
+    for (const auto mode : modes) {
+      for (std::uint32_t seed = 0; seed < 4; ++seed) {
+        if (h.build(names, mode, seed)) {
+          return h;
+        }
+      }
+    }
+  }
+
+  return name_hash_t<names.size(), CaseInsensitive>{}; // Duplicate names.
+}
+
+template <typename E, enum_subtype S, bool CaseInsensitive = false>
+inline constexpr auto name_hash_v = name_hash<E, S, CaseInsensitive>();
+
+template <typename E, enum_subtype S, typename BinaryPredicate>
+constexpr bool has_name_hash() noexcept {
+#if defined(MAGIC_ENUM_NO_PERFECT_HASH)
+  return false;
+#else
+  if constexpr (is_default_predicate_v<BinaryPredicate>) {
+    return name_hash_v<E, S>.mode != name_hash_mode::none;
+  } else if constexpr (is_case_insensitive_predicate_v<BinaryPredicate>) {
+    return name_hash_v<E, S, true>.mode != name_hash_mode::none;
+  } else {
+    return false;
+  }
+#endif
+}
+
+// Returns index + 1 of name in names_v, or 0 if not found.
+template <typename E, enum_subtype S, typename BinaryPredicate>
+constexpr std::size_t find_name(string_view value, BinaryPredicate&& p) noexcept(is_nothrow_invocable_v<BinaryPredicate>) {
+  constexpr auto& h = name_hash_v<E, S, is_case_insensitive_predicate_v<BinaryPredicate>>;
+
+  if (value.empty()) {
+    return 0;
+  }
+  if (const auto i = h.find(value); i != 0 && cmp_equal(value, name_at<E, S>(i - 1), p)) {
+    return i;
+  }
+  return 0;
+}
+
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>, std::size_t... I>
+constexpr auto ualues(std::index_sequence<I...>) noexcept {
+  return std::array<U, sizeof...(I)>{{static_cast<U>(values_v<E, S>[I])...}};
+}
+
+// Packed underlying values, in the same order as values_v.
+template <typename E, enum_subtype S>
+inline constexpr auto ualues_v = ualues<E, S>(std::make_index_sequence<count_v<E, S>>{});
+
+#if defined(MAGIC_ENUM_SIMD_SSE2)
+template <std::size_t Size>
+inline __m128i simd_set1_128(std::int64_t v) noexcept {
+  if constexpr (Size == 1) {
+    return _mm_set1_epi8(static_cast<char>(v));
+  } else if constexpr (Size == 2) {
+    return _mm_set1_epi16(static_cast<short>(v));
+  } else if constexpr (Size == 4) {
+    return _mm_set1_epi32(static_cast<int>(v));
+  } else {
+    return _mm_set1_epi64x(static_cast<long long>(v));
+  }
+}
+
+template <std::size_t Size>
+inline __m128i simd_cmpeq_128(__m128i a, __m128i b) noexcept {
+  if constexpr (Size == 1) {
+    return _mm_cmpeq_epi8(a, b);
+  } else if constexpr (Size == 2) {
+    return _mm_cmpeq_epi16(a, b);
+  } else if constexpr (Size == 4) {
+    return _mm_cmpeq_epi32(a, b);
+  } else {
+    // SSE2 has no 64-bit compare, both 32-bit halves must be equal.
+    const auto eq = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+  }
+}
+
+#  if defined(MAGIC_ENUM_SIMD_AVX2)
+template <std::size_t Size>
+inline __m256i simd_set1_256(std::int64_t v) noexcept {
+  if constexpr (Size == 1) {
+    return _mm256_set1_epi8(static_cast<char>(v));
+  } else if constexpr (Size == 2) {
+    return _mm256_set1_epi16(static_cast<short>(v));
+  } else if constexpr (Size == 4) {
+    return _mm256_set1_epi32(static_cast<int>(v));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(v));
+  }
+}
+
+template <std::size_t Size>
+inline __m256i simd_cmpeq_256(__m256i a, __m256i b) noexcept {
+  if constexpr (Size == 1) {
+    return _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (Size == 2) {
+    return _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (Size == 4) {
+    return _mm256_cmpeq_epi32(a, b);
+  } else {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+}
+#  endif
+
+inline std::size_t simd_first_lane(unsigned mask, std::size_t lane_size) noexcept {
+#  if defined(__GNUC__) || defined(__clang__)
+  return static_cast<std::size_t>(__builtin_ctz(mask)) / lane_size;
+#  else
+  std::size_t i = 0;
+  for (; (mask & 1U) == 0; mask >>= 1) {
+    ++i;
+  }
+  return i / lane_size;
+#  endif
+}
+
+// Returns index + 1 of value in values, or 0 if not found.
+template <typename U, std::size_t N>
+std::size_t simd_find(const std::array<U, N>& values, U value) noexcept {
+  std::size_t i = 0;
+#  if defined(MAGIC_ENUM_SIMD_AVX2)
+  if constexpr (N >= 32 / sizeof(U)) {
+    const auto needle = simd_set1_256<sizeof(U)>(static_cast<std::int64_t>(value));
+    for (; i + 32 / sizeof(U) <= N; i += 32 / sizeof(U)) {
+      const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i));
+      if (const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(simd_cmpeq_256<sizeof(U)>(chunk, needle))); mask != 0) {
+        return i + simd_first_lane(mask, sizeof(U)) + 1;
+      }
+    }
+  }
+#  endif
+  if constexpr (N >= 16 / sizeof(U)) {
+    const auto needle = simd_set1_128<sizeof(U)>(static_cast<std::int64_t>(value));
+    for (; i + 16 / sizeof(U) <= N; i += 16 / sizeof(U)) {
+      const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i));
+      if (const auto mask = static_cast<unsigned>(_mm_movemask_epi8(simd_cmpeq_128<sizeof(U)>(chunk, needle))); mask != 0) {
+        return i + simd_first_lane(mask, sizeof(U)) + 1;
+      }
+    }
+  }
+  for (; i < N; ++i) {
+    if (values[i] == value) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+#endif
+
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr std::size_t index_table_size() noexcept {
+  if constexpr (count_v<E, S> == 0 || count_v<E, S> >= 65535 || std::is_same_v<U, bool>) {
+    return 0;
+  } else if constexpr (!is_sparse_v<E, S> && S != enum_subtype::flags) {
+    return 0; // Dense enum computes index from value.
+  } else {
+    constexpr auto span = static_cast<std::uint64_t>(max_v<E, S>) - static_cast<std::uint64_t>(min_v<E, S>);
+    return span < static_cast<std::uint64_t>(MAGIC_ENUM_INDEX_TABLE_MAX) ? static_cast<std::size_t>(span + 1) : 0;
+  }
+}
+
+template <typename E, enum_subtype S>
+inline constexpr bool has_index_table_v = index_table_size<E, S>() > 0;
+
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr auto index_table() noexcept {
+  using index_type = std::conditional_t<(count_v<E, S> < 255), std::uint8_t, std::uint16_t>;
+
+  // Each entry stores index + 1 of value min_v + offset, or 0 if value has no name.
+  std::array<index_type, index_table_size<E, S>()> table{};
+  for (std::size_t i = 0; i < count_v<E, S>; ++i) {
+    const auto offset = static_cast<std::uint64_t>(ualues_v<E, S>[i]) - static_cast<std::uint64_t>(min_v<E, S>);
+    table[static_cast<std::size_t>(offset)] = static_cast<index_type>(i + 1);
+  }
+
+  return table;
+}
+
+template <typename E, enum_subtype S>
+inline constexpr auto index_table_v = index_table<E, S>();
+
+// Returns index + 1 of value in values_v, or 0 if not found.
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr std::size_t search_value(U value) noexcept {
+  constexpr auto& values = ualues_v<E, S>;
+
+#if defined(MAGIC_ENUM_SIMD_SSE2)
+  if constexpr (!std::is_same_v<U, bool> && values.size() >= 16 / sizeof(U)) {
+    if (!MAGIC_ENUM_IS_CONSTANT_EVALUATED()) {
+      return simd_find(values, value);
+    }
+  }
+#endif
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (values[i] == value) {
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+// Returns index + 1 of value in values_v, or 0 if not found.
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr std::size_t find_value(U value) noexcept {
+  if constexpr (has_index_table_v<E, S>) {
+    const auto offset = static_cast<std::uint64_t>(value) - static_cast<std::uint64_t>(min_v<E, S>);
+    return offset < index_table_v<E, S>.size() ? index_table_v<E, S>[static_cast<std::size_t>(offset)] : 0;
+  } else {
+    return search_value<E, S>(value);
+  }
+}
+
 template <typename E, enum_subtype S>
 struct is_reflected
 #if defined(MAGIC_ENUM_NO_CHECK_REFLECTED_ENUM)
@@ -1303,17 +1990,20 @@ template <typename E, detail::enum_subtype S = detail::subtype_v<E>>
   using U = underlying_type_t<D>;
   static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
 
-  if constexpr (detail::is_sparse_v<D, S> || (S == detail::enum_subtype::flags)) {
+  if constexpr (detail::has_index_table_v<D, S>) {
+    if (const auto i = detail::find_value<D, S>(static_cast<U>(value))) {
+      return i - 1;
+    }
+    return {}; // Invalid value or out of range.
+  } else if constexpr (detail::is_sparse_v<D, S> || (S == detail::enum_subtype::flags)) {
 #if defined(MAGIC_ENUM_ENABLE_HASH)
     return detail::constexpr_switch<&detail::values_v<D, S>, detail::case_call_t::index>(
         [](std::size_t i) { return optional<std::size_t>{i}; },
         value,
         detail::default_result_type_lambda<optional<std::size_t>>);
 #else
-    for (std::size_t i = 0; i < detail::count_v<D, S>; ++i) {
-      if (enum_value<D, S>(i) == value) {
-        return i;
-      }
+    if (const auto i = detail::find_value<D, S>(static_cast<U>(value))) {
+      return i - 1;
     }
     return {}; // Invalid value or out of range.
 #endif
@@ -1365,7 +2055,7 @@ template <typename E, detail::enum_subtype S = detail::subtype_v<E>>
   static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
 
   if (const auto i = enum_index<D, S>(value)) {
-    return detail::names_v<D, S>[*i];
+    return detail::name_at<D, S>(*i);
   }
   return detail::static_str<0>{}.str();
 }
@@ -1408,17 +2098,20 @@ template <typename E, detail::enum_subtype S = detail::subtype_v<E>>
   using D = std::decay_t<E>;
   static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
 
-  if constexpr (detail::is_sparse_v<D, S> || (S == detail::enum_subtype::flags)) {
+  if constexpr (detail::has_index_table_v<D, S>) {
+    if (detail::find_value<D, S>(value) != 0) {
+      return static_cast<D>(value);
+    }
+    return {}; // Invalid value or out of range.
+  } else if constexpr (detail::is_sparse_v<D, S> || (S == detail::enum_subtype::flags)) {
 #if defined(MAGIC_ENUM_ENABLE_HASH)
     return detail::constexpr_switch<&detail::values_v<D, S>, detail::case_call_t::value>(
         [](D v) { return optional<D>{v}; },
         static_cast<D>(value),
         detail::default_result_type_lambda<optional<D>>);
 #else
-    for (std::size_t i = 0; i < detail::count_v<D, S>; ++i) {
-      if (value == static_cast<underlying_type_t<D>>(enum_value<D, S>(i))) {
-        return static_cast<D>(value);
-      }
+    if (detail::find_value<D, S>(value) != 0) {
+      return static_cast<D>(value);
     }
     return {}; // Invalid value or out of range.
 #endif
@@ -1437,24 +2130,73 @@ template <typename E, detail::enum_subtype S = detail::subtype_v<E>, typename Bi
   using D = std::decay_t<E>;
   static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
 
+  if constexpr (detail::has_name_hash<D, S, BinaryPredicate>()) {
+    if (const auto i = detail::find_name<D, S>(value, p)) {
+      return enum_value<D, S>(i - 1);
+    }
+    return {}; // Invalid value or out of range.
 #if defined(MAGIC_ENUM_ENABLE_HASH)
-  if constexpr (detail::is_default_predicate_v<BinaryPredicate>) {
+  } else if constexpr (detail::is_default_predicate_v<BinaryPredicate>) {
     return detail::constexpr_switch<&detail::names_v<D, S>, detail::case_call_t::index>(
         [](std::size_t i) { return optional<D>{detail::values_v<D, S>[i]}; },
         value,
         detail::default_result_type_lambda<optional<D>>,
         [&p](string_view lhs, string_view rhs) { return detail::cmp_equal(lhs, rhs, p); });
-  } else {
 #endif
+  } else {
     for (std::size_t i = 0; i < detail::count_v<D, S>; ++i) {
-      if (detail::cmp_equal(value, detail::names_v<D, S>[i], p)) {
+      if (detail::cmp_equal(value, detail::name_at<D, S>(i), p)) {
         return enum_value<D, S>(i);
       }
     }
     return {}; // Invalid value or out of range.
-#if defined(MAGIC_ENUM_ENABLE_HASH)
   }
-#endif
+}
+
+// Casts each integer value or name from contiguous range `in` (std::span, std::array, std::vector, C array) and writes results to contiguous range `out`.
+// Returns number of successfully cast values.
+template <typename E, detail::enum_subtype S = detail::subtype_v<E>, typename In, typename Out, typename BinaryPredicate = std::equal_to<>>
+constexpr auto enum_cast_batch(const In& in, Out&& out, [[maybe_unused]] BinaryPredicate p = {}) noexcept(detail::is_nothrow_invocable_v<BinaryPredicate>) -> detail::enable_if_t<E, std::size_t, BinaryPredicate> {
+  using D = std::decay_t<E>;
+  using U = underlying_type_t<D>;
+  using T = std::decay_t<decltype(*std::data(in))>;
+  static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
+  static_assert(std::is_convertible_v<const T&, string_view> || std::is_integral_v<T>, "magic_enum::enum_cast_batch requires integer or string input.");
+  static_assert(std::is_assignable_v<decltype(*std::data(out)), optional<D>>, "magic_enum::enum_cast_batch requires optional<E> output.");
+
+  const std::size_t size = std::size(in);
+  const auto* values = std::data(in);
+  auto* results = std::data(out);
+  MAGIC_ENUM_ASSERT(std::size(out) >= size);
+
+  std::size_t count = 0;
+  if constexpr (std::is_convertible_v<const T&, string_view>) {
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto v = enum_cast<D, S, BinaryPredicate&>(string_view{values[i]}, p);
+      count += v.has_value() ? 1U : 0U;
+      results[i] = v;
+    }
+  } else if constexpr (detail::is_sparse_v<D, S> || (S == detail::enum_subtype::flags) || std::is_same_v<U, bool>) {
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto v = detail::in_range<U>(values[i]) ? enum_cast<D, S>(static_cast<U>(values[i])) : optional<D>{};
+      count += v.has_value() ? 1U : 0U;
+      results[i] = v;
+    }
+  } else {
+    // Dense enum, range check is one unsigned comparison without branch.
+    using UU = std::make_unsigned_t<U>;
+    constexpr auto min = static_cast<UU>(detail::min_v<D, S>);
+    constexpr auto range = static_cast<UU>(static_cast<UU>(detail::max_v<D, S>) - min);
+    for (std::size_t i = 0; i < size; ++i) {
+      // Value that does not fit underlying type is rejected before narrowing, instead of wrapping into range.
+      const auto v = static_cast<U>(values[i]);
+      const bool valid = detail::in_range<U>(values[i]) & (static_cast<UU>(static_cast<UU>(v) - min) <= range);
+      count += valid ? 1U : 0U;
+      results[i] = valid ? optional<D>{static_cast<D>(v)} : optional<D>{};
+    }
+  }
+
+  return count;
 }
 
 // Returns true if enum contains specified value.
@@ -1598,5 +2340,9 @@ constexpr E& operator^=(E& lhs, E rhs) noexcept {
 #undef MAGIC_ENUM_VS_2017_WORKAROUND
 #undef MAGIC_ENUM_ARRAY_CONSTEXPR
 #undef MAGIC_ENUM_FOR_EACH_256
+#undef MAGIC_ENUM_BATCH_VALID
+#undef MAGIC_ENUM_IS_CONSTANT_EVALUATED
+#undef MAGIC_ENUM_SIMD_AVX2
+#undef MAGIC_ENUM_SIMD_SSE2
 
 #endif // NEARGYE_MAGIC_ENUM_HPP
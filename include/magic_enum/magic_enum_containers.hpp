@@ -36,22 +36,10 @@
 #include "magic_enum.hpp"
 
 #ifndef MAGIC_ENUM_USE_STD_MODULE
+#  include <atomic>
 #  include <initializer_list>
 #  include <iterator>
-#endif
-
-#if !defined(MAGIC_ENUM_USE_STD_MODULE) && __has_include(<bit>) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
-#  include <bit>
-#endif
-
-#if (!defined(__cpp_lib_bitops) || (__cpp_lib_bitops < 201907L)) && defined(_MSC_VER) && !defined(__clang__)
-#  include <intrin.h>
-#  pragma intrinsic(_BitScanForward)
-#  pragma intrinsic(_BitScanReverse)
-#  ifdef _WIN64
-#    pragma intrinsic(_BitScanForward64)
-#    pragma intrinsic(_BitScanReverse64)
-#  endif
+#  include <new>
 #endif
 
 #if !defined(MAGIC_ENUM_NO_EXCEPTION) && (defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND))
@@ -59,6 +47,7 @@
 #    include <stdexcept>
 #  endif
 #  define MAGIC_ENUM_CONTAINERS_THROW(...) throw (__VA_ARGS__)
+#  define MAGIC_ENUM_CONTAINERS_EXCEPTIONS 1
 #else
 #  ifndef MAGIC_ENUM_USE_STD_MODULE
 #    include <cstdlib>
@@ -66,10 +55,35 @@
 #  define MAGIC_ENUM_CONTAINERS_THROW(...) std::abort()
 #endif
 
+// Cache line size that keeps containers::counter_array shards apart. By default MAGIC_ENUM_CACHE_LINE_SIZE = 64.
+// If need another size (e.g. 128 for some ARM cores), redefine the macro MAGIC_ENUM_CACHE_LINE_SIZE.
+#if !defined(MAGIC_ENUM_CACHE_LINE_SIZE)
+#  define MAGIC_ENUM_CACHE_LINE_SIZE 64
+#endif
+static_assert(MAGIC_ENUM_CACHE_LINE_SIZE > 0 && (MAGIC_ENUM_CACHE_LINE_SIZE & (MAGIC_ENUM_CACHE_LINE_SIZE - 1)) == 0, "MAGIC_ENUM_CACHE_LINE_SIZE must be power of 2.");
+
+// Bulk operations of wide bitset use SSE2/AVX2 at runtime, constant evaluation uses scalar loops.
+// If need scalar loops only, define the macro MAGIC_ENUM_NO_SIMD.
+#if !defined(MAGIC_ENUM_NO_SIMD) && !defined(MAGIC_ENUM_USE_STD_MODULE)
+#  if defined(__AVX2__)
+#    include <immintrin.h>
+#    define MAGIC_ENUM_CONTAINERS_SIMD_AVX2 1
+#    define MAGIC_ENUM_CONTAINERS_SIMD_SSE2 1
+#  elif defined(__SSE2__) || defined(_M_X64) || defined(_M_IX86_FP) && _M_IX86_FP >= 2
+#    include <emmintrin.h>
+#    define MAGIC_ENUM_CONTAINERS_SIMD_SSE2 1
+#  endif
+#endif
+
 namespace magic_enum::containers {
 
 namespace detail {
 
+using magic_enum::detail::bit_width;
+using magic_enum::detail::countl_zero;
+using magic_enum::detail::countr_zero;
+using magic_enum::detail::popcount;
+
 template <typename T, typename = void>
 inline constexpr bool is_transparent_v{};
 
@@ -110,20 +124,6 @@ constexpr bool lexicographical_compare(T1&& t1, T2&& t2, Cmp&& cmp = {}) {
   return (first1 == last1) && (first2 != last2);
 }
 
-template <typename T>
-constexpr std::size_t popcount(T x) noexcept {
-#if defined(__cpp_lib_bitops) && __cpp_lib_bitops >= 201907L
-  return static_cast<std::size_t>(std::popcount(x));
-#else
-  std::size_t c = 0;
-  while (x > 0) {
-    x &= x - 1;
-    ++c;
-  }
-  return c;
-#endif
-}
-
 namespace impl {
 
 template <typename Cmp = std::less<>, typename ForwardIt, typename E>
@@ -282,138 +282,6 @@ struct name_sort_impl<void, Cmp> {
 
 struct raw_access_t {};
 
-template <typename Parent, typename Iterator, typename Getter, typename Predicate>
-struct FilteredIterator {
-  Parent parent;
-  Iterator first;
-  Iterator last;
-  Iterator current;
-  Getter getter;
-  Predicate predicate;
-
-  using iterator_category = std::bidirectional_iterator_tag;
-  using reference = std::invoke_result_t<Getter, Parent, Iterator>;
-  using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
-  using difference_type = std::ptrdiff_t;
-  using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
-
-  constexpr FilteredIterator() noexcept = default;
-  constexpr FilteredIterator(const FilteredIterator&) = default;
-  constexpr FilteredIterator& operator=(const FilteredIterator&) = default;
-  constexpr FilteredIterator(FilteredIterator&&) noexcept = default;
-  constexpr FilteredIterator& operator=(FilteredIterator&&) noexcept = default;
-
-  template <typename OtherParent, typename OtherIterator, typename = std::enable_if_t<std::is_convertible_v<OtherParent, Parent> && std::is_convertible_v<OtherIterator, Iterator>>*>
-  constexpr explicit FilteredIterator(const FilteredIterator<OtherParent, OtherIterator, Getter, Predicate>& other)
-      : parent(other.parent), first(other.first), last(other.last), current(other.current), getter(other.getter), predicate(other.predicate) {}
-
-  constexpr FilteredIterator(Parent p, Iterator begin, Iterator end, Iterator curr, Getter get = {}, Predicate pred = {})
-      : parent(p), first(std::move(begin)), last(std::move(end)), current(std::move(curr)), getter{std::move(get)}, predicate{std::move(pred)} {
-    if (current == first && !predicate(parent, current)) {
-      ++*this;
-    }
-  }
-
-  [[nodiscard]] constexpr reference operator*() const { return getter(parent, current); }
-
-  [[nodiscard]] constexpr pointer operator->() const { return std::addressof(**this); }
-
-  constexpr FilteredIterator& operator++() {
-    do {
-      ++current;
-    } while (current != last && !predicate(parent, current));
-    return *this;
-  }
-
-  [[nodiscard]] constexpr FilteredIterator operator++(int) {
-    FilteredIterator cp = *this;
-    ++*this;
-    return cp;
-  }
-
-  constexpr FilteredIterator& operator--() {
-    do {
-      --current;
-    } while (current != first && !predicate(parent, current));
-    return *this;
-  }
-
-  [[nodiscard]] constexpr FilteredIterator operator--(int) {
-    FilteredIterator cp = *this;
-    --*this;
-    return cp;
-  }
-
-  [[nodiscard]] friend constexpr bool operator==(const FilteredIterator& lhs, const FilteredIterator& rhs) { return lhs.current == rhs.current; }
-
-  [[nodiscard]] friend constexpr bool operator!=(const FilteredIterator& lhs, const FilteredIterator& rhs) { return lhs.current != rhs.current; }
-};
-
-template <typename T>
-constexpr int countr_zero(T x) noexcept {
-#if defined(__cpp_lib_bitops) && __cpp_lib_bitops >= 201907L
-  return std::countr_zero(x);
-#elif defined(_MSC_VER) && !defined(__clang__)
-  unsigned long index;
-  if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-    return _BitScanForward(&index, static_cast<unsigned long>(x)) ? static_cast<int>(index) : static_cast<int>(sizeof(T) * 8);
-  } else {
-#  ifdef _WIN64
-    return _BitScanForward64(&index, static_cast<unsigned __int64>(x)) ? static_cast<int>(index) : static_cast<int>(sizeof(T) * 8);
-#  else
-    if (_BitScanForward(&index, static_cast<unsigned long>(x))) { return static_cast<int>(index); }
-    return _BitScanForward(&index, static_cast<unsigned long>(x >> 32)) ? static_cast<int>(index) + 32 : static_cast<int>(sizeof(T) * 8);
-#  endif
-  }
-#else
-  if constexpr (sizeof(T) <= sizeof(unsigned int)) {
-    return x ? __builtin_ctz(static_cast<unsigned int>(x)) : static_cast<int>(sizeof(T) * 8);
-  } else if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-    return x ? __builtin_ctzl(static_cast<unsigned long>(x)) : static_cast<int>(sizeof(T) * 8);
-  } else {
-    return x ? __builtin_ctzll(static_cast<unsigned long long>(x)) : static_cast<int>(sizeof(T) * 8);
-  }
-#endif
-}
-
-template <typename T>
-constexpr int countl_zero(T x) noexcept {
-#if defined(__cpp_lib_bitops) && __cpp_lib_bitops >= 201907L
-  return std::countl_zero(x);
-#elif defined(_MSC_VER) && !defined(__clang__)
-  unsigned long index;
-  if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-    return _BitScanReverse(&index, static_cast<unsigned long>(x)) ? static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 1 : static_cast<int>(sizeof(T) * 8);
-  } else {
-#  ifdef _WIN64
-    return _BitScanReverse64(&index, static_cast<unsigned __int64>(x)) ? static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 1 : static_cast<int>(sizeof(T) * 8);
-#  else
-    if (_BitScanReverse(&index, static_cast<unsigned long>(x >> 32))) { return static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 33; }
-    return _BitScanReverse(&index, static_cast<unsigned long>(x)) ? static_cast<int>(sizeof(T) * 8) - static_cast<int>(index) - 1 : static_cast<int>(sizeof(T) * 8);
-#  endif
-  }
-#else
-  // __builtin_clz* counts leading zeros in the promoted type width, not in T.
-  // We must subtract the extra bits introduced by zero-extension.
-  if constexpr (sizeof(T) <= sizeof(unsigned int)) {
-    return x ? __builtin_clz(static_cast<unsigned int>(x)) - static_cast<int>((sizeof(unsigned int) - sizeof(T)) * 8) : static_cast<int>(sizeof(T) * 8);
-  } else if constexpr (sizeof(T) <= sizeof(unsigned long)) {
-    return x ? __builtin_clzl(static_cast<unsigned long>(x)) - static_cast<int>((sizeof(unsigned long) - sizeof(T)) * 8) : static_cast<int>(sizeof(T) * 8);
-  } else {
-    return x ? __builtin_clzll(static_cast<unsigned long long>(x)) - static_cast<int>((sizeof(unsigned long long) - sizeof(T)) * 8) : static_cast<int>(sizeof(T) * 8);
-  }
-#endif
-}
-
-template <typename T>
-constexpr int bit_width(T x) noexcept {
-#if defined(__cpp_lib_int_pow2) && __cpp_lib_int_pow2 >= 202002L
-  return std::bit_width(x);
-#else
-  return std::numeric_limits<T>::digits - countl_zero(x);
-#endif
-}
-
 template <typename E, typename Index>
 constexpr bool valid_indexing() noexcept {
   constexpr std::size_t count = enum_count<E>();
@@ -453,85 +321,214 @@ using comparator_indexing = detail::indexing<void, Cmp>;
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //                                                          ARRAY                                                            //
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename E, typename V, typename Index = default_indexing<E>>
+// Layout policy of array, each value is stored next to the previous one as in std::array.
+struct packed {};
+
+// Layout policy of array, each value is aligned to Stride bytes (cache line by default), so values written by different threads do not share cache line.
+template <std::size_t Stride = MAGIC_ENUM_CACHE_LINE_SIZE>
+struct padded {
+  static_assert(Stride > 0 && (Stride & (Stride - 1)) == 0, "magic_enum::containers::padded requires power of 2 stride.");
+};
+
+namespace detail {
+
+template <typename V, std::size_t Stride>
+struct alignas(Stride > alignof(V) ? Stride : alignof(V)) padded_slot {
+  V value;
+};
+
+// Random access iterator over values of padded slots.
+template <typename V, typename Slot>
+class padded_iterator {
+  template <typename OtherV, typename OtherSlot>
+  friend class padded_iterator;
+
+  Slot* slot = nullptr;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<V>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = V*;
+  using reference = V&;
+
+  constexpr padded_iterator() noexcept = default;
+
+  constexpr explicit padded_iterator(Slot* s) noexcept : slot(s) {}
+
+  template <typename OtherV, typename OtherSlot, typename = std::enable_if_t<std::is_convertible_v<OtherSlot*, Slot*>>>
+  constexpr padded_iterator(const padded_iterator<OtherV, OtherSlot>& other) noexcept : slot(other.slot) {}
+
+  [[nodiscard]] constexpr reference operator*() const noexcept { return slot->value; }
+
+  [[nodiscard]] constexpr pointer operator->() const noexcept { return std::addressof(slot->value); }
+
+  [[nodiscard]] constexpr reference operator[](difference_type n) const noexcept { return slot[n].value; }
+
+  constexpr padded_iterator& operator++() noexcept { return ++slot, *this; }
+
+  [[nodiscard]] constexpr padded_iterator operator++(int) noexcept { return padded_iterator(slot++); }
+
+  constexpr padded_iterator& operator--() noexcept { return --slot, *this; }
+
+  [[nodiscard]] constexpr padded_iterator operator--(int) noexcept { return padded_iterator(slot--); }
+
+  constexpr padded_iterator& operator+=(difference_type n) noexcept { return slot += n, *this; }
+
+  constexpr padded_iterator& operator-=(difference_type n) noexcept { return slot -= n, *this; }
+
+  [[nodiscard]] friend constexpr padded_iterator operator+(padded_iterator it, difference_type n) noexcept { return it += n; }
+
+  [[nodiscard]] friend constexpr padded_iterator operator+(difference_type n, padded_iterator it) noexcept { return it += n; }
+
+  [[nodiscard]] friend constexpr padded_iterator operator-(padded_iterator it, difference_type n) noexcept { return it -= n; }
+
+  [[nodiscard]] friend constexpr difference_type operator-(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot - rhs.slot; }
+
+  [[nodiscard]] friend constexpr bool operator==(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot == rhs.slot; }
+
+  [[nodiscard]] friend constexpr bool operator!=(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot != rhs.slot; }
+
+  [[nodiscard]] friend constexpr bool operator<(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot < rhs.slot; }
+
+  [[nodiscard]] friend constexpr bool operator<=(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot <= rhs.slot; }
+
+  [[nodiscard]] friend constexpr bool operator>(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot > rhs.slot; }
+
+  [[nodiscard]] friend constexpr bool operator>=(const padded_iterator& lhs, const padded_iterator& rhs) noexcept { return lhs.slot >= rhs.slot; }
+};
+
+template <typename V, std::size_t N, typename Layout>
+struct array_slots;
+
+template <typename V, std::size_t N>
+struct array_slots<V, N, packed> {
+  using container_type = std::array<V, N>;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+
+  [[nodiscard]] static constexpr V& get(container_type& a, std::size_t i) noexcept { return a[i]; }
+
+  [[nodiscard]] static constexpr const V& get(const container_type& a, std::size_t i) noexcept { return a[i]; }
+
+  [[nodiscard]] static constexpr iterator begin(container_type& a) noexcept { return a.begin(); }
+
+  [[nodiscard]] static constexpr const_iterator begin(const container_type& a) noexcept { return a.begin(); }
+
+  [[nodiscard]] static constexpr iterator end(container_type& a) noexcept { return a.end(); }
+
+  [[nodiscard]] static constexpr const_iterator end(const container_type& a) noexcept { return a.end(); }
+};
+
+template <typename V, std::size_t N, std::size_t Stride>
+struct array_slots<V, N, padded<Stride>> {
+  using slot_type = padded_slot<V, Stride>;
+  using container_type = std::array<slot_type, N>;
+  using iterator = padded_iterator<V, slot_type>;
+  using const_iterator = padded_iterator<const V, const slot_type>;
+
+  [[nodiscard]] static constexpr V& get(container_type& a, std::size_t i) noexcept { return a[i].value; }
+
+  [[nodiscard]] static constexpr const V& get(const container_type& a, std::size_t i) noexcept { return a[i].value; }
+
+  [[nodiscard]] static constexpr iterator begin(container_type& a) noexcept { return iterator(a.data()); }
+
+  [[nodiscard]] static constexpr const_iterator begin(const container_type& a) noexcept { return const_iterator(a.data()); }
+
+  [[nodiscard]] static constexpr iterator end(container_type& a) noexcept { return iterator(a.data() + N); }
+
+  [[nodiscard]] static constexpr const_iterator end(const container_type& a) noexcept { return const_iterator(a.data() + N); }
+};
+
+} // namespace detail
+
+template <typename E, typename V, typename Index = default_indexing<E>, typename Layout = packed>
 struct array {
   static_assert(std::is_enum_v<E>, "magic_enum::containers::array requires enum type.");
   static_assert(detail::valid_indexing<E, Index>(), "magic_enum::containers::array requires non-empty reflected enum and valid indexing.");
 
+ private:
+  using slots = detail::array_slots<V, enum_count<E>(), Layout>;
+
+ public:
   using index_type = Index;
-  using container_type = std::array<V, enum_count<E>()>;
+  using layout_type = Layout;
+  using container_type = typename slots::container_type;
 
-  using value_type = typename container_type::value_type;
-  using size_type = typename container_type::size_type;
-  using difference_type = typename container_type::difference_type;
-  using reference = typename container_type::reference;
-  using const_reference = typename container_type::const_reference;
-  using pointer = typename container_type::pointer;
-  using const_pointer = typename container_type::const_pointer;
-  using iterator = typename container_type::iterator;
-  using const_iterator = typename container_type::const_iterator;
-  using reverse_iterator = typename container_type::reverse_iterator;
-  using const_reverse_iterator = typename container_type::const_reverse_iterator;
+  using value_type = V;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = V&;
+  using const_reference = const V&;
+  using pointer = V*;
+  using const_pointer = const V*;
+  using iterator = typename slots::iterator;
+  using const_iterator = typename slots::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   constexpr reference at(E pos) {
     if (auto index = index_type::at(pos); index && *index < a.size()) {
-      return a[*index];
+      return slots::get(a, *index);
     }
     MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::array::at: Unrecognized position"));
   }
 
   constexpr const_reference at(E pos) const {
     if (auto index = index_type::at(pos); index && *index < a.size()) {
-      return a[*index];
+      return slots::get(a, *index);
     }
     MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::array::at: Unrecognized position"));
   }
 
   [[nodiscard]] constexpr reference operator[](E pos) {
     auto i = index_type::at(pos);
-    return MAGIC_ENUM_ASSERT(i && *i < a.size()), a[*i];
+    return MAGIC_ENUM_ASSERT(i && *i < a.size()), slots::get(a, *i);
   }
 
   [[nodiscard]] constexpr const_reference operator[](E pos) const {
     auto i = index_type::at(pos);
-    return MAGIC_ENUM_ASSERT(i && *i < a.size()), a[*i];
+    return MAGIC_ENUM_ASSERT(i && *i < a.size()), slots::get(a, *i);
   }
 
-  [[nodiscard]] constexpr reference front() noexcept { return a.front(); }
+  [[nodiscard]] constexpr reference front() noexcept { return slots::get(a, 0); }
 
-  [[nodiscard]] constexpr const_reference front() const noexcept { return a.front(); }
+  [[nodiscard]] constexpr const_reference front() const noexcept { return slots::get(a, 0); }
 
-  [[nodiscard]] constexpr reference back() noexcept { return a.back(); }
+  [[nodiscard]] constexpr reference back() noexcept { return slots::get(a, a.size() - 1); }
 
-  [[nodiscard]] constexpr const_reference back() const noexcept { return a.back(); }
+  [[nodiscard]] constexpr const_reference back() const noexcept { return slots::get(a, a.size() - 1); }
 
+  // Values are contiguous only in packed layout.
+  template <typename L = Layout, std::enable_if_t<std::is_same_v<L, packed>, int> = 0>
   [[nodiscard]] constexpr pointer data() noexcept { return a.data(); }
 
+  template <typename L = Layout, std::enable_if_t<std::is_same_v<L, packed>, int> = 0>
   [[nodiscard]] constexpr const_pointer data() const noexcept { return a.data(); }
 
-  [[nodiscard]] constexpr iterator begin() noexcept { return a.begin(); }
+  [[nodiscard]] constexpr iterator begin() noexcept { return slots::begin(a); }
 
-  [[nodiscard]] constexpr const_iterator begin() const noexcept { return a.begin(); }
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return slots::begin(a); }
 
-  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return a.cbegin(); }
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return slots::begin(a); }
 
-  [[nodiscard]] constexpr iterator end() noexcept { return a.end(); }
+  [[nodiscard]] constexpr iterator end() noexcept { return slots::end(a); }
 
-  [[nodiscard]] constexpr const_iterator end() const noexcept { return a.end(); }
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return slots::end(a); }
 
-  [[nodiscard]] constexpr const_iterator cend() const noexcept { return a.cend(); }
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return slots::end(a); }
 
-  [[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return a.rbegin(); }
+  [[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
 
-  [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return a.rbegin(); }
+  [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
 
-  [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return a.crbegin(); }
+  [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator{end()}; }
 
-  [[nodiscard]] constexpr reverse_iterator rend() noexcept { return a.rend(); }
+  [[nodiscard]] constexpr reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
 
-  [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return a.rend(); }
+  [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
 
-  [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return a.crend(); }
+  [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator{begin()}; }
 
   [[nodiscard]] constexpr bool empty() const noexcept { return a.empty(); }
 
@@ -540,16 +537,16 @@ struct array {
   [[nodiscard]] constexpr size_type max_size() const noexcept { return a.max_size(); }
 
   constexpr void fill(const V& value) {
-    for (auto& v : a) {
+    for (auto& v : *this) {
       v = value;
     }
   }
 
   constexpr void swap(array& other) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_assignable_v<V>) {
     for (std::size_t i = 0; i < a.size(); ++i) {
-      auto v = std::move(other.a[i]);
-      other.a[i] = std::move(a[i]);
-      a[i] = std::move(v);
+      auto v = std::move(slots::get(other.a, i));
+      slots::get(other.a, i) = std::move(slots::get(a, i));
+      slots::get(a, i) = std::move(v);
     }
   }
 
@@ -600,96 +597,486 @@ constexpr std::enable_if_t<(enum_count<E>() == sizeof...(Ts)), array<E, std::rem
 inline constexpr detail::raw_access_t raw_access{};
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-//                                                         BITSET                                                            //
+//                                                         MATRIX                                                            //
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-template <typename E, typename Index = default_indexing<E>>
-class bitset {
-  static_assert(std::is_enum_v<E>, "magic_enum::containers::bitset requires enum type.");
-  static_assert(detail::valid_indexing<E, Index>(), "magic_enum::containers::bitset requires non-empty reflected enum and valid indexing.");
+namespace detail {
 
-  using base_type = std::conditional_t<enum_count<E>() <= 8,  std::uint_least8_t,
-                    std::conditional_t<enum_count<E>() <= 16, std::uint_least16_t,
-                    std::conditional_t<enum_count<E>() <= 32, std::uint_least32_t,
-                                                              std::uint_least64_t>>>;
+template <typename... Es>
+constexpr std::size_t matrix_size() noexcept {
+  constexpr std::size_t counts[] = {enum_count<Es>()...};
+  std::size_t size = 1;
+  for (const auto count : counts) {
+    size *= count;
+  }
 
-  static constexpr std::size_t bits_per_base = sizeof(base_type) * 8;
-  static constexpr std::size_t base_type_count = (enum_count<E>() > 0 ? (enum_count<E>() - 1) / bits_per_base + 1 : 0);
-  static constexpr std::size_t not_interested = base_type_count * bits_per_base - enum_count<E>();
-  static constexpr base_type last_value_max = [] {
-    if constexpr (not_interested == 0) {
-      return (std::numeric_limits<base_type>::max)();
-    } else {
-      return static_cast<base_type>((base_type{1} << (bits_per_base - not_interested)) - 1);
-    }
-  }();
+  return size;
+}
 
-  [[nodiscard]] static constexpr base_type bit_mask(std::size_t index) noexcept {
-    return static_cast<base_type>(base_type{1} << (index % bits_per_base));
+template <typename E>
+constexpr optional<std::size_t> matrix_index(optional<std::size_t> key, E value) noexcept {
+  if (key) {
+    if (const auto index = indexing<E>::at(value)) {
+      return *key * enum_count<E>() + *index;
+    }
   }
+  return {};
+}
 
-  [[nodiscard]] static constexpr base_type least_significant_bit(base_type value) noexcept {
-    MAGIC_ENUM_ASSERT(value != 0);
-    return bit_mask(static_cast<std::size_t>(detail::countr_zero(value)));
-  }
+} // namespace detail
 
-  template <typename parent_t = bitset*>
-  class reference_impl {
-    friend class bitset;
+// Flat row-major array with element for each combination of enum values, first enum is the most significant (outermost) dimension.
+template <typename V, typename E1, typename E2, typename... Es>
+struct matrix {
+  static_assert(std::is_enum_v<E1> && std::is_enum_v<E2> && (std::is_enum_v<Es> && ...), "magic_enum::containers::matrix requires enum types.");
+  static_assert(detail::valid_indexing<E1, default_indexing<E1>>() && detail::valid_indexing<E2, default_indexing<E2>>() && (detail::valid_indexing<Es, default_indexing<Es>>() && ...), "magic_enum::containers::matrix requires non-empty reflected enums.");
 
-    parent_t parent;
-    std::size_t num_index;
-    base_type bit_index;
+  using container_type = std::array<V, detail::matrix_size<E1, E2, Es...>()>;
 
-    constexpr reference_impl(parent_t p, std::size_t i) noexcept : reference_impl(p, std::pair{i / bits_per_base, bit_mask(i)}) {}
+  using value_type = typename container_type::value_type;
+  using size_type = typename container_type::size_type;
+  using difference_type = typename container_type::difference_type;
+  using reference = typename container_type::reference;
+  using const_reference = typename container_type::const_reference;
+  using pointer = typename container_type::pointer;
+  using const_pointer = typename container_type::const_pointer;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+  using reverse_iterator = typename container_type::reverse_iterator;
+  using const_reverse_iterator = typename container_type::const_reverse_iterator;
 
-    constexpr reference_impl(parent_t p, std::pair<std::size_t, base_type> i) noexcept : parent(p), num_index(std::get<0>(i)), bit_index(std::get<1>(i)) {}
+  // Returns flat index of combination of enum values, same as enum_fuse_dense.
+  [[nodiscard]] static constexpr optional<size_type> index(E1 pos1, E2 pos2, Es... pos) noexcept {
+    auto key = detail::matrix_index(detail::matrix_index(optional<size_type>{0}, pos1), pos2);
+    ((key = detail::matrix_index(key, pos)), ...);
+    return key;
+  }
 
-   public:
-    constexpr reference_impl& operator=(bool v) noexcept {
-      if (v) {
-        parent->a[num_index] |= bit_index;
-      } else {
-        parent->a[num_index] &= ~bit_index;
-      }
-      return *this;
+  constexpr reference at(E1 pos1, E2 pos2, Es... pos) {
+    if (auto i = index(pos1, pos2, pos...)) {
+      return a[*i];
     }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::matrix::at: Unrecognized position"));
+  }
 
-    constexpr reference_impl& operator=(const reference_impl& v) noexcept {
-      if (this == &v) {
-        return *this;
-      }
-      *this = static_cast<bool>(v);
-      return *this;
+  constexpr const_reference at(E1 pos1, E2 pos2, Es... pos) const {
+    if (auto i = index(pos1, pos2, pos...)) {
+      return a[*i];
     }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::matrix::at: Unrecognized position"));
+  }
 
-    [[nodiscard]] constexpr operator bool() const noexcept { return (parent->a[num_index] & bit_index) > 0; }
-
-    [[nodiscard]] constexpr bool operator~() const noexcept { return !static_cast<bool>(*this); }
-
-    constexpr reference_impl& flip() noexcept {
-      *this = ~*this;
-      return *this;
-    }
-  };
+  [[nodiscard]] constexpr reference operator()(E1 pos1, E2 pos2, Es... pos) {
+    auto i = index(pos1, pos2, pos...);
+    return MAGIC_ENUM_ASSERT(i), a[*i];
+  }
 
-  template <typename T>
-  [[nodiscard]] constexpr T to_(detail::raw_access_t) const {
-    if constexpr (std::numeric_limits<T>::digits < std::numeric_limits<base_type>::digits) {
-      if (a[0] > static_cast<base_type>((std::numeric_limits<T>::max)())) {
-        MAGIC_ENUM_CONTAINERS_THROW(std::overflow_error("magic_enum::containers::bitset::to: Cannot represent enum in this type"));
-      }
-    }
-    for (std::size_t i = 1; i < base_type_count; ++i) {
-      if (a[i] != 0) {
-        MAGIC_ENUM_CONTAINERS_THROW(std::overflow_error("magic_enum::containers::bitset::to: Cannot represent enum in this type"));
-      }
-    }
-    return static_cast<T>(a[0]);
+  [[nodiscard]] constexpr const_reference operator()(E1 pos1, E2 pos2, Es... pos) const {
+    auto i = index(pos1, pos2, pos...);
+    return MAGIC_ENUM_ASSERT(i), a[*i];
   }
 
-  template <typename parent_t = bitset*>
-  class iterator_impl {
-    friend class bitset;
+  [[nodiscard]] constexpr reference front() noexcept { return a.front(); }
+
+  [[nodiscard]] constexpr const_reference front() const noexcept { return a.front(); }
+
+  [[nodiscard]] constexpr reference back() noexcept { return a.back(); }
+
+  [[nodiscard]] constexpr const_reference back() const noexcept { return a.back(); }
+
+  [[nodiscard]] constexpr pointer data() noexcept { return a.data(); }
+
+  [[nodiscard]] constexpr const_pointer data() const noexcept { return a.data(); }
+
+  [[nodiscard]] constexpr iterator begin() noexcept { return a.begin(); }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return a.begin(); }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return a.cbegin(); }
+
+  [[nodiscard]] constexpr iterator end() noexcept { return a.end(); }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return a.end(); }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return a.cend(); }
+
+  [[nodiscard]] constexpr reverse_iterator rbegin() noexcept { return a.rbegin(); }
+
+  [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return a.rbegin(); }
+
+  [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept { return a.crbegin(); }
+
+  [[nodiscard]] constexpr reverse_iterator rend() noexcept { return a.rend(); }
+
+  [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return a.rend(); }
+
+  [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept { return a.crend(); }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return a.empty(); }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return a.size(); }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return a.max_size(); }
+
+  constexpr void fill(const V& value) {
+    for (auto& v : a) {
+      v = value;
+    }
+  }
+
+  constexpr void swap(matrix& other) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_move_assignable_v<V>) {
+    for (std::size_t i = 0; i < a.size(); ++i) {
+      auto v = std::move(other.a[i]);
+      other.a[i] = std::move(a[i]);
+      a[i] = std::move(v);
+    }
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const matrix& m1, const matrix& m2) { return detail::equal(m1, m2); }
+
+  [[nodiscard]] friend constexpr bool operator!=(const matrix& m1, const matrix& m2) { return !detail::equal(m1, m2); }
+
+  [[nodiscard]] friend constexpr bool operator<(const matrix& m1, const matrix& m2) { return detail::lexicographical_compare(m1, m2); }
+
+  [[nodiscard]] friend constexpr bool operator<=(const matrix& m1, const matrix& m2) { return !detail::lexicographical_compare(m2, m1); }
+
+  [[nodiscard]] friend constexpr bool operator>(const matrix& m1, const matrix& m2) { return detail::lexicographical_compare(m2, m1); }
+
+  [[nodiscard]] friend constexpr bool operator>=(const matrix& m1, const matrix& m2) { return !detail::lexicographical_compare(m1, m2); }
+
+  container_type a;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                         BITSET                                                            //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+// Word operations of bitset, vector overloads are used by SIMD kernels below.
+struct bit_and {
+  template <typename T>
+  [[nodiscard]] static constexpr T apply(T x, T y) noexcept { return static_cast<T>(x & y); }
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+  [[nodiscard]] static __m128i apply(__m128i x, __m128i y) noexcept { return _mm_and_si128(x, y); }
+#endif
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  [[nodiscard]] static __m256i apply(__m256i x, __m256i y) noexcept { return _mm256_and_si256(x, y); }
+#endif
+};
+
+struct bit_or {
+  template <typename T>
+  [[nodiscard]] static constexpr T apply(T x, T y) noexcept { return static_cast<T>(x | y); }
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+  [[nodiscard]] static __m128i apply(__m128i x, __m128i y) noexcept { return _mm_or_si128(x, y); }
+#endif
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  [[nodiscard]] static __m256i apply(__m256i x, __m256i y) noexcept { return _mm256_or_si256(x, y); }
+#endif
+};
+
+struct bit_xor {
+  template <typename T>
+  [[nodiscard]] static constexpr T apply(T x, T y) noexcept { return static_cast<T>(x ^ y); }
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+  [[nodiscard]] static __m128i apply(__m128i x, __m128i y) noexcept { return _mm_xor_si128(x, y); }
+#endif
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  [[nodiscard]] static __m256i apply(__m256i x, __m256i y) noexcept { return _mm256_xor_si256(x, y); }
+#endif
+};
+
+struct bit_and_not {
+  template <typename T>
+  [[nodiscard]] static constexpr T apply(T x, T y) noexcept { return static_cast<T>(x & static_cast<T>(~y)); }
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+  [[nodiscard]] static __m128i apply(__m128i x, __m128i y) noexcept { return _mm_andnot_si128(y, x); }
+#endif
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  [[nodiscard]] static __m256i apply(__m256i x, __m256i y) noexcept { return _mm256_andnot_si256(y, x); }
+#endif
+};
+
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+using simd_word = std::uint_least64_t;
+
+inline __m128i simd_load_128(const simd_word* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+
+// Per byte SWAR count, then sum of bytes in each 64-bit lane.
+inline __m128i simd_popcount_128(__m128i v) noexcept {
+  const auto m1 = _mm_set1_epi8(0x55);
+  const auto m2 = _mm_set1_epi8(0x33);
+  const auto m4 = _mm_set1_epi8(0x0F);
+  v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+  v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+  v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+  return _mm_sad_epu8(v, _mm_setzero_si128());
+}
+
+inline std::size_t simd_sum_128(__m128i v) noexcept {
+  alignas(16) std::uint64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), v);
+  return static_cast<std::size_t>(lanes[0] + lanes[1]);
+}
+
+#  if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+inline __m256i simd_load_256(const simd_word* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+
+inline __m256i simd_popcount_256(__m256i v) noexcept {
+  const auto m1 = _mm256_set1_epi8(0x55);
+  const auto m2 = _mm256_set1_epi8(0x33);
+  const auto m4 = _mm256_set1_epi8(0x0F);
+  v = _mm256_sub_epi8(v, _mm256_and_si256(_mm256_srli_epi64(v, 1), m1));
+  v = _mm256_add_epi8(_mm256_and_si256(v, m2), _mm256_and_si256(_mm256_srli_epi64(v, 2), m2));
+  v = _mm256_and_si256(_mm256_add_epi8(v, _mm256_srli_epi64(v, 4)), m4);
+  return _mm256_sad_epu8(v, _mm256_setzero_si256());
+}
+#  endif
+
+// dst[i] = Op(dst[i], src[i]), 256 or 128 bits per step and scalar tail.
+template <typename Op, std::size_t N>
+void simd_apply(simd_word* dst, const simd_word* src) noexcept {
+  std::size_t i = 0;
+#  if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  for (; i + 4 <= N; i += 4) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::apply(simd_load_256(dst + i), simd_load_256(src + i)));
+  }
+#  endif
+  for (; i + 2 <= N; i += 2) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::apply(simd_load_128(dst + i), simd_load_128(src + i)));
+  }
+  for (; i < N; ++i) {
+    dst[i] = Op::apply(dst[i], src[i]);
+  }
+}
+
+// Whether any bit of Op(lhs[i], rhs[i]) is set, no early exit so loop stays branch-free.
+template <typename Op, std::size_t N>
+bool simd_any(const simd_word* lhs, const simd_word* rhs) noexcept {
+  std::size_t i = 0;
+  auto acc = _mm_setzero_si128();
+#  if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  if constexpr (N >= 4) {
+    auto acc256 = _mm256_setzero_si256();
+    for (; i + 4 <= N; i += 4) {
+      acc256 = _mm256_or_si256(acc256, Op::apply(simd_load_256(lhs + i), simd_load_256(rhs + i)));
+    }
+    acc = _mm_or_si128(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+  }
+#  endif
+  for (; i + 2 <= N; i += 2) {
+    acc = _mm_or_si128(acc, Op::apply(simd_load_128(lhs + i), simd_load_128(rhs + i)));
+  }
+  simd_word tail = 0;
+  for (; i < N; ++i) {
+    tail |= Op::apply(lhs[i], rhs[i]);
+  }
+  return tail != 0 || _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) != 0xFFFF;
+}
+
+// Number of set bits of Op(lhs[i], rhs[i]).
+template <typename Op, std::size_t N>
+std::size_t simd_count(const simd_word* lhs, const simd_word* rhs) noexcept {
+  std::size_t i = 0;
+  auto acc = _mm_setzero_si128();
+#  if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  if constexpr (N >= 4) {
+    auto acc256 = _mm256_setzero_si256();
+    for (; i + 4 <= N; i += 4) {
+      acc256 = _mm256_add_epi64(acc256, simd_popcount_256(Op::apply(simd_load_256(lhs + i), simd_load_256(rhs + i))));
+    }
+    acc = _mm_add_epi64(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+  }
+#  endif
+  for (; i + 2 <= N; i += 2) {
+    acc = _mm_add_epi64(acc, simd_popcount_128(Op::apply(simd_load_128(lhs + i), simd_load_128(rhs + i))));
+  }
+  std::size_t c = simd_sum_128(acc);
+  for (; i < N; ++i) {
+    c += popcount(Op::apply(lhs[i], rhs[i]));
+  }
+  return c;
+}
+
+// Whether first N words are all ones.
+template <std::size_t N>
+bool simd_all(const simd_word* p) noexcept {
+  std::size_t i = 0;
+  const auto ones = _mm_set1_epi32(-1);
+  auto acc = ones;
+#  if defined(MAGIC_ENUM_CONTAINERS_SIMD_AVX2)
+  if constexpr (N >= 4) {
+    auto acc256 = _mm256_set1_epi32(-1);
+    for (; i + 4 <= N; i += 4) {
+      acc256 = _mm256_and_si256(acc256, simd_load_256(p + i));
+    }
+    acc = _mm_and_si128(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+  }
+#  endif
+  for (; i + 2 <= N; i += 2) {
+    acc = _mm_and_si128(acc, simd_load_128(p + i));
+  }
+  auto tail = ~simd_word{0};
+  for (; i < N; ++i) {
+    tail &= p[i];
+  }
+  return tail == ~simd_word{0} && _mm_movemask_epi8(_mm_cmpeq_epi8(acc, ones)) == 0xFFFF;
+}
+#endif
+
+} // namespace detail
+
+template <typename E, typename Index = default_indexing<E>>
+class bitset {
+  static_assert(std::is_enum_v<E>, "magic_enum::containers::bitset requires enum type.");
+  static_assert(detail::valid_indexing<E, Index>(), "magic_enum::containers::bitset requires non-empty reflected enum and valid indexing.");
+
+  using base_type = std::conditional_t<enum_count<E>() <= 8,  std::uint_least8_t,
+                    std::conditional_t<enum_count<E>() <= 16, std::uint_least16_t,
+                    std::conditional_t<enum_count<E>() <= 32, std::uint_least32_t,
+                                                              std::uint_least64_t>>>;
+
+  static constexpr std::size_t bits_per_base = sizeof(base_type) * 8;
+  static constexpr std::size_t base_type_count = (enum_count<E>() > 0 ? (enum_count<E>() - 1) / bits_per_base + 1 : 0);
+  static constexpr std::size_t not_interested = base_type_count * bits_per_base - enum_count<E>();
+  static constexpr base_type last_value_max = [] {
+    if constexpr (not_interested == 0) {
+      return (std::numeric_limits<base_type>::max)();
+    } else {
+      return static_cast<base_type>((base_type{1} << (bits_per_base - not_interested)) - 1);
+    }
+  }();
+
+  [[nodiscard]] static constexpr base_type bit_mask(std::size_t index) noexcept {
+    return static_cast<base_type>(base_type{1} << (index % bits_per_base));
+  }
+
+  [[nodiscard]] static constexpr base_type least_significant_bit(base_type value) noexcept {
+    MAGIC_ENUM_ASSERT(value != 0);
+    return bit_mask(static_cast<std::size_t>(detail::countr_zero(value)));
+  }
+
+  // Multiword 64-bit storage goes through SIMD kernels outside constant evaluation.
+  static constexpr bool simd_words = sizeof(base_type) == sizeof(std::uint_least64_t) && base_type_count >= 2;
+
+  template <typename Op>
+  constexpr bitset& apply(const bitset& other) noexcept {
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+    if constexpr (simd_words) {
+      if (!magic_enum::detail::is_constant_evaluated()) {
+        detail::simd_apply<Op, base_type_count>(a.data(), other.a.data());
+        return *this;
+      }
+    }
+#endif
+    for (std::size_t i = 0; i < base_type_count; ++i) {
+      a[i] = Op::apply(a[i], other.a[i]);
+    }
+    return *this;
+  }
+
+  template <typename Op>
+  [[nodiscard]] constexpr bool any_of(const bitset& other) const noexcept {
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+    if constexpr (simd_words) {
+      if (!magic_enum::detail::is_constant_evaluated()) {
+        return detail::simd_any<Op, base_type_count>(a.data(), other.a.data());
+      }
+    }
+#endif
+    for (std::size_t i = 0; i < base_type_count; ++i) {
+      if (Op::apply(a[i], other.a[i]) != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename Op>
+  [[nodiscard]] constexpr std::size_t count_of(const bitset& other) const noexcept {
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+    if constexpr (simd_words) {
+      if (!magic_enum::detail::is_constant_evaluated()) {
+        return detail::simd_count<Op, base_type_count>(a.data(), other.a.data());
+      }
+    }
+#endif
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < base_type_count; ++i) {
+      c += detail::popcount(Op::apply(a[i], other.a[i]));
+    }
+    return c;
+  }
+
+  template <typename, typename>
+  friend class set;
+
+  template <typename, typename>
+  friend class atomic_bitset;
+
+  constexpr bitset& subtract(const bitset& other) noexcept { return apply<detail::bit_and_not>(other); }
+
+  [[nodiscard]] constexpr bool is_subset_of(const bitset& other) const noexcept { return !any_of<detail::bit_and_not>(other); }
+
+  template <typename parent_t = bitset*>
+  class reference_impl {
+    friend class bitset;
+
+    parent_t parent;
+    std::size_t num_index;
+    base_type bit_index;
+
+    constexpr reference_impl(parent_t p, std::size_t i) noexcept : reference_impl(p, std::pair{i / bits_per_base, bit_mask(i)}) {}
+
+    constexpr reference_impl(parent_t p, std::pair<std::size_t, base_type> i) noexcept : parent(p), num_index(std::get<0>(i)), bit_index(std::get<1>(i)) {}
+
+   public:
+    constexpr reference_impl& operator=(bool v) noexcept {
+      if (v) {
+        parent->a[num_index] |= bit_index;
+      } else {
+        parent->a[num_index] &= ~bit_index;
+      }
+      return *this;
+    }
+
+    constexpr reference_impl& operator=(const reference_impl& v) noexcept {
+      if (this == &v) {
+        return *this;
+      }
+      *this = static_cast<bool>(v);
+      return *this;
+    }
+
+    [[nodiscard]] constexpr operator bool() const noexcept { return (parent->a[num_index] & bit_index) > 0; }
+
+    [[nodiscard]] constexpr bool operator~() const noexcept { return !static_cast<bool>(*this); }
+
+    constexpr reference_impl& flip() noexcept {
+      *this = ~*this;
+      return *this;
+    }
+  };
+
+  template <typename T>
+  [[nodiscard]] constexpr T to_(detail::raw_access_t) const {
+    if constexpr (std::numeric_limits<T>::digits < std::numeric_limits<base_type>::digits) {
+      if (a[0] > static_cast<base_type>((std::numeric_limits<T>::max)())) {
+        MAGIC_ENUM_CONTAINERS_THROW(std::overflow_error("magic_enum::containers::bitset::to: Cannot represent enum in this type"));
+      }
+    }
+    for (std::size_t i = 1; i < base_type_count; ++i) {
+      if (a[i] != 0) {
+        MAGIC_ENUM_CONTAINERS_THROW(std::overflow_error("magic_enum::containers::bitset::to: Cannot represent enum in this type"));
+      }
+    }
+    return static_cast<T>(a[0]);
+  }
+
+  template <typename parent_t = bitset*>
+  class iterator_impl {
+    friend class bitset;
+    template <typename, typename>
+    friend class set;
 
     parent_t parent = nullptr;
     std::size_t num_index = 0;
@@ -718,15 +1105,21 @@ class bitset {
 
     constexpr iterator_impl(parent_t p, std::pair<std::size_t, base_type> i) noexcept : parent(p), num_index(std::get<0>(i)), bit_index(std::get<1>(i)) {}
 
-    [[nodiscard]] static constexpr iterator_impl begin(parent_t p) noexcept {
-      for (std::size_t num_index = 0; num_index < base_type_count; ++num_index) {
-        if (p->a[num_index] > 0) {
-          const auto bit_index = least_significant_bit(p->a[num_index]);
-          return iterator_impl(p, std::pair{num_index, bit_index});
+    // First set bit at position i or later, zero words are skipped whole.
+    [[nodiscard]] static constexpr iterator_impl at_or_after(parent_t p, std::size_t i) noexcept {
+      if (std::size_t word = i / bits_per_base; word < base_type_count) {
+        auto bits = static_cast<base_type>(p->a[word] & static_cast<base_type>(~static_cast<base_type>(bit_mask(i) - 1)));
+        while (bits == 0 && ++word < base_type_count) {
+          bits = p->a[word];
+        }
+        if (word < base_type_count) {
+          return iterator_impl(p, std::pair{word, least_significant_bit(bits)});
         }
       }
       return end(p);
     }
+
+    [[nodiscard]] static constexpr iterator_impl begin(parent_t p) noexcept { return at_or_after(p, 0); }
     [[nodiscard]] static constexpr iterator_impl end(parent_t p) noexcept {
       return iterator_impl(p, enum_count<E>());
     }
@@ -922,6 +1315,13 @@ class bitset {
   }
 
   [[nodiscard]] constexpr bool all() const noexcept {
+#if defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2)
+    if constexpr (simd_words) {
+      if (!magic_enum::detail::is_constant_evaluated()) {
+        return detail::simd_all<base_type_count - 1>(a.data()) && a[base_type_count - 1] == last_value_max;
+      }
+    }
+#endif
     for (std::size_t i = 0; i + 1 < base_type_count; ++i) {
       if (a[i] != (std::numeric_limits<base_type>::max)()) {
         return false;
@@ -941,38 +1341,22 @@ class bitset {
 
   [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
 
-  [[nodiscard]] constexpr std::size_t count() const noexcept {
-    std::size_t c = 0;
-    for (auto& v : a) {
-      c += detail::popcount(v);
-    }
-    return c;
-  }
+  [[nodiscard]] constexpr std::size_t count() const noexcept { return count_of<detail::bit_or>(*this); }
+
+  // Fused (*this & other).count() and (*this & other).any(), no temporary bitset is built.
+  [[nodiscard]] constexpr std::size_t and_count(const bitset& other) const noexcept { return count_of<detail::bit_and>(other); }
+
+  [[nodiscard]] constexpr bool intersects(const bitset& other) const noexcept { return any_of<detail::bit_and>(other); }
 
   [[nodiscard]] constexpr std::size_t size() const noexcept { return enum_count<E>(); }
 
   [[nodiscard]] constexpr std::size_t max_size() const noexcept { return enum_count<E>(); }
 
-  constexpr bitset& operator&=(const bitset& other) noexcept {
-    for (std::size_t i = 0; i < base_type_count; ++i) {
-      a[i] &= other.a[i];
-    }
-    return *this;
-  }
+  constexpr bitset& operator&=(const bitset& other) noexcept { return apply<detail::bit_and>(other); }
 
-  constexpr bitset& operator|=(const bitset& other) noexcept {
-    for (std::size_t i = 0; i < base_type_count; ++i) {
-      a[i] |= other.a[i];
-    }
-    return *this;
-  }
+  constexpr bitset& operator|=(const bitset& other) noexcept { return apply<detail::bit_or>(other); }
 
-  constexpr bitset& operator^=(const bitset& other) noexcept {
-    for (std::size_t i = 0; i < base_type_count; ++i) {
-      a[i] ^= other.a[i];
-    }
-    return *this;
-  }
+  constexpr bitset& operator^=(const bitset& other) noexcept { return apply<detail::bit_xor>(other); }
 
   [[nodiscard]] constexpr bitset operator~() const noexcept {
     bitset res = *this;
@@ -1007,11 +1391,9 @@ class bitset {
   }
 
   constexpr bitset& flip() noexcept {
-    for (auto& value : a) {
-      value = static_cast<base_type>(~value);
-    }
-    a[base_type_count - 1] &= last_value_max;
-    return *this;
+    bitset ones;
+    ones.set();
+    return apply<detail::bit_xor>(ones);
   }
 
   [[nodiscard]] friend constexpr bitset operator&(const bitset& lhs, const bitset& rhs) noexcept {
@@ -1091,18 +1473,97 @@ class bitset {
 template <typename V, int = 0>
 explicit bitset(V starter) -> bitset<V>;
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                      ATOMIC BITSET                                                        //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+template <typename E, typename Index = default_indexing<E>>
+class atomic_bitset {
+  static_assert(std::is_enum_v<E>, "magic_enum::containers::atomic_bitset requires enum type.");
+  static_assert(detail::valid_indexing<E, Index>(), "magic_enum::containers::atomic_bitset requires non-empty reflected enum and valid indexing.");
+
+ public:
+  using index_type = Index;
+  using bitset_type = bitset<E, Index>;
+  using word_type = typename bitset_type::container_type::value_type;
+
+ private:
+  static constexpr std::size_t bits_per_word = sizeof(word_type) * 8;
+  static constexpr std::size_t word_count = std::tuple_size_v<typename bitset_type::container_type>;
+
+  // Word and bit mask of pos, same layout as bitset so snapshot copies words as is.
+  [[nodiscard]] static constexpr optional<std::pair<std::size_t, word_type>> position(E pos) noexcept {
+    if (auto i = index_type::at(pos); i && *i < enum_count<E>()) {
+      return std::pair{*i / bits_per_word, static_cast<word_type>(word_type{1} << (*i % bits_per_word))};
+    }
+    return {};
+  }
+
+ public:
+  static constexpr bool is_always_lock_free = std::atomic<word_type>::is_always_lock_free;
+
+  atomic_bitset() noexcept : a{} {}
+
+  explicit atomic_bitset(const bitset_type& value) noexcept : a{} { store(value, std::memory_order_relaxed); }
+
+  atomic_bitset(const atomic_bitset&) = delete;
+  atomic_bitset& operator=(const atomic_bitset&) = delete;
+
+  [[nodiscard]] bool test(E pos, std::memory_order order = std::memory_order_seq_cst) const {
+    if (const auto p = position(pos)) {
+      return (a[p->first].load(order) & p->second) != 0;
+    }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::atomic_bitset::test: Unrecognized position"));
+  }
+
+  void set(E pos, std::memory_order order = std::memory_order_seq_cst) { static_cast<void>(test_and_set(pos, order)); }
+
+  void reset(E pos, std::memory_order order = std::memory_order_seq_cst) { static_cast<void>(test_and_reset(pos, order)); }
+
+  // Sets bit and returns its previous value.
+  bool test_and_set(E pos, std::memory_order order = std::memory_order_seq_cst) {
+    if (const auto p = position(pos)) {
+      return (a[p->first].fetch_or(p->second, order) & p->second) != 0;
+    }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::atomic_bitset::set: Unrecognized position"));
+  }
+
+  // Resets bit and returns its previous value.
+  bool test_and_reset(E pos, std::memory_order order = std::memory_order_seq_cst) {
+    if (const auto p = position(pos)) {
+      return (a[p->first].fetch_and(static_cast<word_type>(~p->second), order) & p->second) != 0;
+    }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::atomic_bitset::reset: Unrecognized position"));
+  }
+
+  // Each word is loaded atomically, but words are not read as one atomic unit.
+  [[nodiscard]] bitset_type snapshot(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    bitset_type res;
+    for (std::size_t i = 0; i < word_count; ++i) {
+      res.a[i] = a[i].load(order);
+    }
+    return res;
+  }
+
+  void store(const bitset_type& value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    for (std::size_t i = 0; i < word_count; ++i) {
+      a[i].store(value.a[i], order);
+    }
+  }
+
+  void reset(std::memory_order order = std::memory_order_seq_cst) noexcept { store(bitset_type{}, order); }
+
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return enum_count<E>(); }
+
+ private:
+  std::atomic<word_type> a[word_count];
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //                                                           SET                                                             //
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 template <typename E, typename Cmp = std::less<E>>
 class set {
   using index_type = detail::indexing<E, Cmp>;
-  struct Getter {
-    constexpr const E& operator()(const set*, const E* p) const noexcept { return *p; }
-  };
-  struct Predicate {
-    constexpr bool operator()(const set* h, const E* e) const noexcept { return h->a[*e]; }
-  };
 
  public:
   using container_type = bitset<E, index_type>;
@@ -1116,8 +1577,8 @@ class set {
   using const_reference = const value_type&;
   using pointer = value_type*;
   using const_pointer = const value_type*;
-  using iterator = detail::FilteredIterator<const set*, const E*, Getter, Predicate>;
-  using const_iterator = detail::FilteredIterator<const set*, const E*, Getter, Predicate>;
+  using iterator = typename container_type::const_iterator;
+  using const_iterator = typename container_type::const_iterator;
   using reverse_iterator = std::reverse_iterator<iterator>;
   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
@@ -1158,21 +1619,17 @@ class set {
     return *this;
   }
 
-  constexpr const_iterator begin() const noexcept {
-    return const_iterator{this, index_type::begin(), index_type::end(), index_type::begin()};
-  }
+  constexpr const_iterator begin() const noexcept { return a.begin(); }
 
-  constexpr const_iterator end() const noexcept {
-    return const_iterator{this, index_type::begin(), index_type::end(), index_type::end()};
-  }
+  constexpr const_iterator end() const noexcept { return a.end(); }
 
   constexpr const_iterator cbegin() const noexcept { return begin(); }
 
   constexpr const_iterator cend() const noexcept { return end(); }
 
-  constexpr const_reverse_iterator rbegin() const noexcept { return {end()}; }
+  constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{end()}; }
 
-  constexpr const_reverse_iterator rend() const noexcept { return {begin()}; }
+  constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{begin()}; }
 
   constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
 
@@ -1198,7 +1655,7 @@ class set {
         ++s;
       }
 
-      return {iterator{this, index_type::begin(), index_type::end(), index_type::it(*i)}, res};
+      return {iterator{&a, *i}, res};
     }
     return {end(), false};
   }
@@ -1283,17 +1740,14 @@ class set {
   }
 
   [[nodiscard]] constexpr const_iterator find(const key_type& key) const noexcept {
-    if (auto i = index_type::at(key); i && a.test(key)) {
-      return const_iterator{this, index_type::begin(), index_type::end(), index_type::it(*i)};
-    }
-    return end();
+    return a.find(key);
   }
 
   template <typename K, typename KC = key_compare>
   [[nodiscard]] constexpr std::enable_if_t<detail::is_transparent_v<KC>, const_iterator> find(const K& x) const {
     for (auto [first, last] = detail::equal_range(index_type::begin(), index_type::end(), x, key_compare{}); first != last; ++first) {
       if (a.test(*first)) {
-        return const_iterator{this, index_type::begin(), index_type::end(), first};
+        return const_iterator{&a, static_cast<std::size_t>(first - index_type::begin())};
       }
     }
     return end();
@@ -1308,10 +1762,7 @@ class set {
 
  private:
   [[nodiscard]] constexpr const_iterator iterator_at_or_after(const E* it) const noexcept {
-    while (it != index_type::end() && !a.test(*it)) {
-      ++it;
-    }
-    return const_iterator{this, index_type::begin(), index_type::end(), it};
+    return const_iterator::at_or_after(&a, static_cast<std::size_t>(it - index_type::begin()));
   }
 
  public:
@@ -1346,6 +1797,57 @@ class set {
 
   [[nodiscard]] constexpr value_compare value_comp() const { return {}; }
 
+  // Set algebra combines bitset words directly and recounts size with popcount.
+  constexpr set& operator|=(const set& other) noexcept {
+    a |= other.a;
+    s = a.count();
+    return *this;
+  }
+
+  constexpr set& operator&=(const set& other) noexcept {
+    a &= other.a;
+    s = a.count();
+    return *this;
+  }
+
+  constexpr set& operator^=(const set& other) noexcept {
+    a ^= other.a;
+    s = a.count();
+    return *this;
+  }
+
+  constexpr set& operator-=(const set& other) noexcept {
+    a.subtract(other.a);
+    s = a.count();
+    return *this;
+  }
+
+  [[nodiscard]] constexpr bool includes(const set& other) const noexcept { return other.s <= s && other.a.is_subset_of(a); }
+
+  [[nodiscard]] constexpr friend set operator|(const set& lhs, const set& rhs) noexcept {
+    set cp = lhs;
+    cp |= rhs;
+    return cp;
+  }
+
+  [[nodiscard]] constexpr friend set operator&(const set& lhs, const set& rhs) noexcept {
+    set cp = lhs;
+    cp &= rhs;
+    return cp;
+  }
+
+  [[nodiscard]] constexpr friend set operator^(const set& lhs, const set& rhs) noexcept {
+    set cp = lhs;
+    cp ^= rhs;
+    return cp;
+  }
+
+  [[nodiscard]] constexpr friend set operator-(const set& lhs, const set& rhs) noexcept {
+    set cp = lhs;
+    cp -= rhs;
+    return cp;
+  }
+
   [[nodiscard]] constexpr friend bool operator==(const set& lhs, const set& rhs) noexcept { return lhs.a == rhs.a; }
 
   [[nodiscard]] constexpr friend bool operator!=(const set& lhs, const set& rhs) noexcept { return lhs.a != rhs.a; }
@@ -1381,43 +1883,513 @@ class set {
 template <typename V, int = 0>
 explicit set(V starter) -> set<V>;
 
-template <auto J, typename E, typename V, typename Index>
-constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), V&> get(array<E, V, Index>& a) noexcept {
-  return a.a[J];
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                           MAP                                                             //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+// Uninitialized slot for each enum value, value lives in slot only while its bit in present is set.
+template <typename E, typename V, typename Index>
+class map_storage {
+  struct alignas(V) slot {
+    unsigned char bytes[sizeof(V)];
+  };
+
+  template <typename Other>
+  void assign_values(Other&& other) {
+    for (const auto key : other.present) {
+      const auto i = *Index::at(key);
+      if constexpr (std::is_lvalue_reference_v<Other>) {
+        construct(i, other.get(i));
+      } else {
+        construct(i, std::move(other.get(i)));
+      }
+      present[key] = true;
+    }
+  }
+
+  // Expects empty storage. If copy or move of value throws, values constructed so far are destroyed, so constructor that throws leaks nothing.
+  template <typename Other>
+  void assign(Other&& other) {
+#if defined(MAGIC_ENUM_CONTAINERS_EXCEPTIONS)
+    try {
+      assign_values(std::forward<Other>(other));
+    } catch (...) {
+      clear();
+      throw;
+    }
+#else
+    assign_values(std::forward<Other>(other));
+#endif
+  }
+
+ public:
+  bitset<E, Index> present;
+
+  map_storage() noexcept : present{} {}
+
+  map_storage(const map_storage& other) : present{} { assign(other); }
+
+  map_storage(map_storage&& other) noexcept(std::is_nothrow_move_constructible_v<V>) : present{} { assign(std::move(other)); }
+
+  map_storage& operator=(const map_storage& other) {
+    if (this != &other) {
+      clear();
+      assign(other);
+    }
+    return *this;
+  }
+
+  map_storage& operator=(map_storage&& other) noexcept(std::is_nothrow_move_constructible_v<V>) {
+    if (this != &other) {
+      clear();
+      assign(std::move(other));
+    }
+    return *this;
+  }
+
+  ~map_storage() { clear(); }
+
+  // Swaps values of keys present in both, moves the rest to other side, so absent slots are never touched.
+  void swap(map_storage& other) noexcept(std::is_nothrow_move_constructible_v<V> && std::is_nothrow_swappable_v<V>) {
+    using std::swap;
+    for (const auto key : present | other.present) {
+      const auto i = *Index::at(key);
+      auto here = present[key];
+      auto there = other.present[key];
+      if (here && there) {
+        swap(get(i), other.get(i));
+      } else if (here) {
+        other.construct(i, std::move(get(i)));
+        there = true;
+        destroy(i);
+        here = false;
+      } else {
+        construct(i, std::move(other.get(i)));
+        here = true;
+        other.destroy(i);
+        there = false;
+      }
+    }
+  }
+
+  friend void swap(map_storage& lhs, map_storage& rhs) noexcept(noexcept(lhs.swap(rhs))) { lhs.swap(rhs); }
+
+  [[nodiscard]] V& get(std::size_t i) noexcept { return *std::launder(reinterpret_cast<V*>(values[i].bytes)); }
+
+  [[nodiscard]] const V& get(std::size_t i) const noexcept { return *std::launder(reinterpret_cast<const V*>(values[i].bytes)); }
+
+  template <typename... Args>
+  void construct(std::size_t i, Args&&... args) {
+    ::new (static_cast<void*>(values[i].bytes)) V(std::forward<Args>(args)...);
+  }
+
+  void destroy(std::size_t i) noexcept { get(i).~V(); }
+
+  void clear() noexcept {
+    for (const auto key : present) {
+      destroy(*Index::at(key));
+    }
+    present.reset();
+  }
+
+ private:
+  slot values[enum_count<E>()];
+};
+
+// Default constructed value for each enum value, absent values are reset to default.
+template <typename E, typename V, typename Index>
+struct flat_map_storage {
+  static_assert(std::is_default_constructible_v<V>, "magic_enum::containers::flat_map requires default constructible value type.");
+
+  bitset<E, Index> present;
+  std::array<V, enum_count<E>()> values;
+
+  constexpr flat_map_storage() noexcept(std::is_nothrow_default_constructible_v<V>) : present{}, values{} {}
+
+  [[nodiscard]] constexpr V& get(std::size_t i) noexcept { return values[i]; }
+
+  [[nodiscard]] constexpr const V& get(std::size_t i) const noexcept { return values[i]; }
+
+  template <typename... Args>
+  constexpr void construct(std::size_t i, Args&&... args) {
+    values[i] = V(std::forward<Args>(args)...);
+  }
+
+  constexpr void destroy(std::size_t i) { values[i] = V{}; }
+
+  constexpr void clear() {
+    for (const auto key : present) {
+      destroy(*Index::at(key));
+    }
+    present.reset();
+  }
+};
+
+template <typename E, typename V, typename Index, typename Storage>
+class basic_map {
+  static_assert(std::is_enum_v<E>, "magic_enum::containers::map requires enum type.");
+  static_assert(valid_indexing<E, Index>(), "magic_enum::containers::map requires non-empty reflected enum and valid indexing.");
+
+  using present_iterator = typename bitset<E, Index>::const_iterator;
+
+  // Index of key in storage, custom indexing may map unknown keys past the end.
+  [[nodiscard]] static constexpr optional<std::size_t> index(E key) noexcept {
+    if (const auto i = Index::at(key); i && *i < enum_count<E>()) {
+      return *i;
+    }
+    return {};
+  }
+
+  // Walks set bits of presence bitset, so absent keys are skipped word by word.
+  template <typename Parent, typename Value>
+  class iterator_impl {
+    friend class basic_map;
+    template <typename, typename>
+    friend class iterator_impl;
+
+    Parent parent = nullptr;
+    present_iterator it{};
+
+    constexpr iterator_impl(Parent p, present_iterator i) noexcept : parent(p), it(i) {}
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::pair<const E, V>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const E, Value&>;
+
+    struct pointer {
+      reference r;
+
+      [[nodiscard]] constexpr const reference* operator->() const noexcept { return &r; }
+    };
+
+    constexpr iterator_impl() noexcept = default;
+
+    template <typename OtherParent, typename OtherValue, typename = std::enable_if_t<std::is_convertible_v<OtherParent, Parent>>>
+    constexpr iterator_impl(const iterator_impl<OtherParent, OtherValue>& other) noexcept : parent(other.parent), it(other.it) {}
+
+    [[nodiscard]] constexpr reference operator*() const noexcept {
+      const auto key = *it;
+      return {key, parent->a.get(*Index::at(key))};
+    }
+
+    [[nodiscard]] constexpr pointer operator->() const noexcept { return {**this}; }
+
+    constexpr iterator_impl& operator++() noexcept {
+      ++it;
+      return *this;
+    }
+
+    [[nodiscard]] constexpr iterator_impl operator++(int) noexcept {
+      iterator_impl cp = *this;
+      ++*this;
+      return cp;
+    }
+
+    constexpr iterator_impl& operator--() noexcept {
+      --it;
+      return *this;
+    }
+
+    [[nodiscard]] constexpr iterator_impl operator--(int) noexcept {
+      iterator_impl cp = *this;
+      --*this;
+      return cp;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const iterator_impl& lhs, const iterator_impl& rhs) noexcept { return lhs.it == rhs.it; }
+
+    [[nodiscard]] friend constexpr bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs) noexcept { return lhs.it != rhs.it; }
+  };
+
+ public:
+  using index_type = Index;
+  using container_type = Storage;
+  using key_type = E;
+  using mapped_type = V;
+  using value_type = std::pair<const E, V>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = std::pair<const E, V&>;
+  using const_reference = std::pair<const E, const V&>;
+  using iterator = iterator_impl<basic_map*, V>;
+  using const_iterator = iterator_impl<const basic_map*, const V>;
+
+  constexpr basic_map() = default;
+
+  constexpr basic_map(std::initializer_list<value_type> ilist) {
+    for (const auto& v : ilist) {
+      insert(v);
+    }
+  }
+
+  [[nodiscard]] constexpr iterator begin() noexcept { return {this, std::as_const(a.present).begin()}; }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return {this, a.present.begin()}; }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+
+  [[nodiscard]] constexpr iterator end() noexcept { return {this, std::as_const(a.present).end()}; }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return {this, a.present.end()}; }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return a.present.none(); }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return a.present.count(); }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return enum_count<E>(); }
+
+  constexpr void clear() noexcept(noexcept(std::declval<Storage&>().clear())) {
+    a.clear();
+  }
+
+  template <typename... Args>
+  constexpr std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    if (const auto i = index(key)) {
+      auto ref = a.present[key];
+      if (ref) {
+        return {iterator{this, std::as_const(a.present).find(key)}, false};
+      }
+      a.construct(*i, std::forward<Args>(args)...);
+      ref = true;
+      return {iterator{this, std::as_const(a.present).find(key)}, true};
+    }
+    return {end(), false};
+  }
+
+  constexpr std::pair<iterator, bool> insert(const value_type& value) { return try_emplace(value.first, value.second); }
+
+  constexpr std::pair<iterator, bool> insert(value_type&& value) { return try_emplace(value.first, std::move(value.second)); }
+
+  template <typename M>
+  constexpr std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+    auto [it, inserted] = try_emplace(key, std::forward<M>(obj));
+    if (!inserted && it != end()) {
+      (*it).second = std::forward<M>(obj);
+    }
+    return {it, inserted};
+  }
+
+  [[nodiscard]] constexpr V& operator[](const key_type& key) {
+    const auto i = index(key);
+    MAGIC_ENUM_ASSERT(i.has_value());
+    try_emplace(key);
+    return a.get(*i);
+  }
+
+  constexpr V& at(const key_type& key) {
+    if (auto i = index(key); i && a.present.test(key)) {
+      return a.get(*i);
+    }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::map::at: Key not found"));
+  }
+
+  constexpr const V& at(const key_type& key) const {
+    if (auto i = index(key); i && a.present.test(key)) {
+      return a.get(*i);
+    }
+    MAGIC_ENUM_CONTAINERS_THROW(std::out_of_range("magic_enum::containers::map::at: Key not found"));
+  }
+
+  constexpr size_type erase(const key_type& key) noexcept(noexcept(std::declval<Storage&>().destroy(0))) {
+    if (auto i = index(key)) {
+      if (auto ref = a.present[key]; ref) {
+        a.destroy(*i);
+        ref = false;
+        return 1;
+      }
+    }
+    return 0;
+  }
+
+  constexpr iterator erase(const_iterator pos) {
+    const auto key = *pos.it;
+    auto next = pos.it;
+    ++next;
+    erase(key);
+    return {this, next};
+  }
+
+  [[nodiscard]] constexpr iterator find(const key_type& key) noexcept {
+    if (index(key)) {
+      return {this, std::as_const(a.present).find(key)};
+    }
+    return end();
+  }
+
+  [[nodiscard]] constexpr const_iterator find(const key_type& key) const noexcept {
+    if (index(key)) {
+      return {this, a.present.find(key)};
+    }
+    return end();
+  }
+
+  [[nodiscard]] constexpr size_type count(const key_type& key) const noexcept { return find(key) != end() ? 1 : 0; }
+
+  [[nodiscard]] constexpr bool contains(const key_type& key) const noexcept { return find(key) != end(); }
+
+  void swap(basic_map& other) noexcept(std::is_nothrow_swappable_v<Storage>) {
+    using std::swap;
+    swap(a, other.a);
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const basic_map& lhs, const basic_map& rhs) {
+    if (lhs.a.present != rhs.a.present) {
+      return false;
+    }
+    for (const auto key : lhs.a.present) {
+      const auto i = *Index::at(key);
+      if (!(lhs.a.get(i) == rhs.a.get(i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  [[nodiscard]] friend constexpr bool operator!=(const basic_map& lhs, const basic_map& rhs) { return !(lhs == rhs); }
+
+ private:
+  // Size is count of presence bitset, so it stays in sync with iteration if copy of values throws midway.
+  container_type a;
+};
+
+} // namespace detail
+
+// Map from enum value to V with O(1) insert, erase and find, values are constructed in place only for present keys.
+template <typename E, typename V, typename Index = default_indexing<E>>
+using map = detail::basic_map<E, V, Index, detail::map_storage<E, V, Index>>;
+
+// Map from enum value to V over std::array of default constructed values, trivially copyable for trivially copyable V and usable in constant expressions.
+template <typename E, typename V, typename Index = default_indexing<E>>
+using flat_map = detail::basic_map<E, V, Index, detail::flat_map_storage<E, V, Index>>;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                                      COUNTER ARRAY                                                        //
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace detail {
+
+// Threads take shard ids round-robin on first use.
+inline std::size_t thread_shard_id() noexcept {
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t id = next.fetch_add(1, std::memory_order_relaxed);
+  return id;
+}
+
+} // namespace detail
+
+template <typename E, std::size_t Shards = 16, typename Index = default_indexing<E>>
+class counter_array {
+  static_assert(std::is_enum_v<E>, "magic_enum::containers::counter_array requires enum type.");
+  static_assert(detail::valid_indexing<E, Index>(), "magic_enum::containers::counter_array requires non-empty reflected enum and valid indexing.");
+  static_assert(Shards > 0, "magic_enum::containers::counter_array requires at least one shard.");
+
+  // Counters of one shard are contiguous and start on own cache line, so threads of different shards never share line.
+  struct alignas(MAGIC_ENUM_CACHE_LINE_SIZE) shard_type {
+    std::atomic<std::uint64_t> c[enum_count<E>()];
+  };
+
+  [[nodiscard]] static constexpr optional<std::size_t> index(E key) noexcept {
+    if (const auto i = Index::at(key); i && *i < enum_count<E>()) {
+      return *i;
+    }
+    return {};
+  }
+
+ public:
+  using index_type = Index;
+  using value_type = std::uint64_t;
+  using size_type = std::size_t;
+
+  static constexpr std::size_t shard_count = Shards;
+
+  counter_array() noexcept : shards{} {}
+
+  counter_array(const counter_array&) = delete;
+  counter_array& operator=(const counter_array&) = delete;
+
+  // Relaxed increment of counter in shard of calling thread, unknown keys are ignored.
+  void add(E key, value_type n = 1) noexcept {
+    if (const auto i = index(key)) {
+      shards[detail::thread_shard_id() % Shards].c[*i].fetch_add(n, std::memory_order_relaxed);
+    }
+  }
+
+  // Sum over shards, concurrent add may or may not be included.
+  [[nodiscard]] value_type get(E key) const noexcept {
+    value_type sum = 0;
+    if (const auto i = index(key)) {
+      for (const auto& shard : shards) {
+        sum += shard.c[*i].load(std::memory_order_relaxed);
+      }
+    }
+    return sum;
+  }
+
+  [[nodiscard]] array<E, value_type, Index> collect() const noexcept {
+    array<E, value_type, Index> res{};
+    for (const auto& shard : shards) {
+      for (std::size_t i = 0; i < enum_count<E>(); ++i) {
+        res.a[i] += shard.c[i].load(std::memory_order_relaxed);
+      }
+    }
+    return res;
+  }
+
+  void reset() noexcept {
+    for (auto& shard : shards) {
+      for (auto& counter : shard.c) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  [[nodiscard]] static constexpr size_type size() noexcept { return enum_count<E>(); }
+
+ private:
+  shard_type shards[Shards];
+};
+
+template <auto J, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), V&> get(array<E, V, Index, Layout>& a) noexcept {
+  return detail::array_slots<V, enum_count<E>(), Layout>::get(a.a, J);
 }
 
-template <auto J, typename E, typename V, typename Index>
-constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), V&&> get(array<E, V, Index>&& a) noexcept {
-  return std::move(a.a[J]);
+template <auto J, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), V&&> get(array<E, V, Index, Layout>&& a) noexcept {
+  return std::move(detail::array_slots<V, enum_count<E>(), Layout>::get(a.a, J));
 }
 
-template <auto J, typename E, typename V, typename Index>
-constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), const V&> get(const array<E, V, Index>& a) noexcept {
-  return a.a[J];
+template <auto J, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), const V&> get(const array<E, V, Index, Layout>& a) noexcept {
+  return detail::array_slots<V, enum_count<E>(), Layout>::get(a.a, J);
 }
 
-template <auto J, typename E, typename V, typename Index>
-constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), const V&&> get(const array<E, V, Index>&& a) noexcept {
-  return std::move(a.a[J]);
+template <auto J, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<(std::is_integral_v<decltype(J)> && J < enum_count<E>()), const V&&> get(const array<E, V, Index, Layout>&& a) noexcept {
+  return std::move(detail::array_slots<V, enum_count<E>(), Layout>::get(a.a, J));
 }
 
-template <auto Enum, typename E, typename V, typename Index>
-constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), V&> get(array<E, V, Index>& a) {
+template <auto Enum, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), V&> get(array<E, V, Index, Layout>& a) {
   return a[Enum];
 }
 
-template <auto Enum, typename E, typename V, typename Index>
-constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), V&&> get(array<E, V, Index>&& a) {
+template <auto Enum, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), V&&> get(array<E, V, Index, Layout>&& a) {
   return std::move(a[Enum]);
 }
 
-template <auto Enum, typename E, typename V, typename Index>
-constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), const V&> get(const array<E, V, Index>& a) {
+template <auto Enum, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), const V&> get(const array<E, V, Index, Layout>& a) {
   return a[Enum];
 }
 
-template <auto Enum, typename E, typename V, typename Index>
-constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), const V&&> get(const array<E, V, Index>&& a) {
+template <auto Enum, typename E, typename V, typename Index, typename Layout>
+constexpr std::enable_if_t<std::is_same_v<decltype(Enum), E> && enum_contains(Enum), const V&&> get(const array<E, V, Index, Layout>&& a) {
   return std::move(a[Enum]);
 }
 
@@ -1452,5 +2424,8 @@ struct std::hash<magic_enum::containers::bitset<E, Index>> {
 };
 
 #undef MAGIC_ENUM_CONTAINERS_THROW
+#undef MAGIC_ENUM_CONTAINERS_EXCEPTIONS
+#undef MAGIC_ENUM_CONTAINERS_SIMD_AVX2
+#undef MAGIC_ENUM_CONTAINERS_SIMD_SSE2
 
 #endif // NEARGYE_MAGIC_ENUM_CONTAINERS_HPP
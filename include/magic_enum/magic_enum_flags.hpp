@@ -34,6 +34,16 @@
 
 #include "magic_enum.hpp"
 
+#ifndef MAGIC_ENUM_USE_STD_MODULE
+#  include <atomic>
+#endif
+
+// Flag enums with count of flags less or equals than MAGIC_ENUM_FLAGS_NAME_CACHE_MAX precompute names of all flag combinations, see enum_flags_name_view.
+// If need names without formatting work, define the macro MAGIC_ENUM_FLAGS_NAME_CACHE_MAX (at most 12, names pool grows as 2^count).
+#if defined(MAGIC_ENUM_FLAGS_NAME_CACHE_MAX)
+static_assert(MAGIC_ENUM_FLAGS_NAME_CACHE_MAX >= 0 && MAGIC_ENUM_FLAGS_NAME_CACHE_MAX <= 12, "MAGIC_ENUM_FLAGS_NAME_CACHE_MAX must be in range [0, 12].");
+#endif
+
 namespace magic_enum {
 
 namespace detail {
@@ -50,8 +60,213 @@ constexpr U values_ors() noexcept {
   return ors;
 }
 
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr std::size_t flags_name_max_size() noexcept {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < count_v<E, S>; ++i) {
+    size += names_v<E, S>[i].size() + (i > 0 ? 1 : 0);
+  }
+
+  return size;
+}
+
+// Index in values_v of flag by its bit position, flags reflect single bits only.
+template <typename E, enum_subtype S, typename U = std::make_unsigned_t<std::underlying_type_t<E>>>
+constexpr auto flags_bit_index() noexcept {
+  std::array<std::uint8_t, std::numeric_limits<U>::digits> index = {};
+  for (std::size_t i = 0; i < count_v<E, S>; ++i) {
+    index[static_cast<std::size_t>(countr_zero(static_cast<U>(values_v<E, S>[i])))] = static_cast<std::uint8_t>(i);
+  }
+
+  return index;
+}
+
+template <typename E, enum_subtype S>
+inline constexpr auto flags_bit_index_v = flags_bit_index<E, S>();
+
+// Calls f with index in values_v of each set bit of value in ascending order, cost scales with count of set bits instead of count of flags.
+template <typename E, enum_subtype S, typename F, typename U = std::underlying_type_t<E>>
+constexpr void for_each_flag(U value, F&& f) {
+  using B = std::make_unsigned_t<U>;
+  for (auto bits = static_cast<B>(value); bits != 0; bits = static_cast<B>(bits & (bits - 1))) {
+    f(static_cast<std::size_t>(flags_bit_index_v<E, S>[static_cast<std::size_t>(countr_zero(bits))]));
+  }
+}
+
+// Returns length of name of valid flag enum value, or 0 if value has no name.
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr std::size_t flags_name_size(U value) noexcept {
+  if (value == 0 || (value & ~values_ors<E, S>()) != 0) {
+    return 0; // Invalid value or out of range.
+  }
+
+  std::size_t size = 0;
+  for_each_flag<E, S>(value, [&size](std::size_t i) {
+    size += name_at<E, S>(i).size() + (size > 0 ? 1 : 0);
+  });
+
+  return size;
+}
+
+template <typename E, enum_subtype S, typename OutputIt, typename U = std::underlying_type_t<E>>
+constexpr OutputIt write_flags_name(OutputIt out, U value, char_type sep) {
+  bool first = true;
+  for_each_flag<E, S>(value, [&out, &first, sep](std::size_t i) {
+    if (!first) {
+      *out++ = sep;
+    }
+    first = false;
+    for (const auto c : name_at<E, S>(i)) {
+      *out++ = c;
+    }
+  });
+
+  return out;
+}
+
+template <typename E, enum_subtype S>
+inline constexpr bool has_flags_name_cache_v =
+#if defined(MAGIC_ENUM_FLAGS_NAME_CACHE_MAX)
+    S == enum_subtype::flags && count_v<E, S> > 0 && count_v<E, S> <= MAGIC_ENUM_FLAGS_NAME_CACHE_MAX;
+#else
+    false;
+#endif
+
+template <typename E, enum_subtype S>
+constexpr std::size_t flags_name_pool_size() noexcept {
+  std::size_t size = 0;
+  for (std::size_t m = 1; m < (std::size_t{1} << count_v<E, S>); ++m) {
+    for (std::size_t i = 0, n = 0; i < count_v<E, S>; ++i) {
+      if (((m >> i) & 1U) != 0) {
+        size += names_v<E, S>[i].size() + (n++ > 0 ? 1 : 0);
+      }
+    }
+  }
+
+  return size;
+}
+
+// Joined names of every combination of flags, bit i of combination is flag values_v[i].
+template <typename E, enum_subtype S>
+struct flags_name_cache_t {
+  static constexpr std::size_t combinations = std::size_t{1} << count_v<E, S>;
+  using offset_type = std::conditional_t<(flags_name_pool_size<E, S>() <= 0xFFFFU), std::uint16_t, std::uint32_t>;
+
+  char_type pool[flags_name_pool_size<E, S>()] = {};
+  // Name of combination m is [pool + offsets[m], pool + offsets[m + 1]).
+  offset_type offsets[combinations + 1] = {};
+};
+
+template <typename E, enum_subtype S>
+constexpr auto flags_name_cache() noexcept {
+  flags_name_cache_t<E, S> cache{};
+  std::size_t p = 0;
+  for (std::size_t m = 0; m < cache.combinations; ++m) {
+    cache.offsets[m] = static_cast<typename flags_name_cache_t<E, S>::offset_type>(p);
+    for (std::size_t i = 0, n = 0; i < count_v<E, S>; ++i) {
+      if (((m >> i) & 1U) != 0) {
+        if (n++ > 0) {
+          cache.pool[p++] = char_type{'|'};
+        }
+        for (const auto c : names_v<E, S>[i]) {
+          cache.pool[p++] = c;
+        }
+      }
+    }
+  }
+  cache.offsets[cache.combinations] = static_cast<typename flags_name_cache_t<E, S>::offset_type>(p);
+
+  return cache;
+}
+
+template <typename E, enum_subtype S>
+inline constexpr auto flags_name_cache_v = flags_name_cache<E, S>();
+
+template <typename E, enum_subtype S, typename U = std::underlying_type_t<E>>
+constexpr string_view cached_flags_name(U value) noexcept {
+  if (value == 0 || (value & ~values_ors<E, S>()) != 0) {
+    return {}; // Invalid value or out of range.
+  }
+
+  std::size_t m = 0;
+  for_each_flag<E, S>(value, [&m](std::size_t i) { m |= std::size_t{1} << i; });
+  constexpr auto& cache = flags_name_cache_v<E, S>;
+
+  return {cache.pool + cache.offsets[m], static_cast<std::size_t>(cache.offsets[m + 1] - cache.offsets[m])};
+}
+
+template <typename T, typename = void>
+struct is_char_buffer : std::false_type {};
+
+template <typename T>
+struct is_char_buffer<T, std::void_t<decltype(std::data(std::declval<T&>())), decltype(std::size(std::declval<T&>()))>> : std::is_same<decltype(std::data(std::declval<T&>())), char_type*> {};
+
 } // namespace magic_enum::detail
 
+// Returns name of flag enum value with separator '|' from precomputed names of all flag combinations, without allocation.
+// Requires count of flags less or equals than MAGIC_ENUM_FLAGS_NAME_CACHE_MAX.
+// If flag enum value has no name or is out of range, returns empty string.
+template <typename E>
+[[nodiscard]] constexpr auto enum_flags_name_view(E value) noexcept -> detail::enable_if_t<E, string_view> {
+  using D = std::decay_t<E>;
+  using U = underlying_type_t<D>;
+  constexpr auto S = detail::enum_subtype::flags;
+  static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
+  static_assert(detail::has_flags_name_cache_v<D, S>, "magic_enum::enum_flags_name_view requires MAGIC_ENUM_FLAGS_NAME_CACHE_MAX greater or equals than count of flags.");
+
+  return detail::cached_flags_name<D, S>(static_cast<U>(value));
+}
+
+// Returns maximum length of name returned by enum_flags_name, when all flags are set.
+// Buffer of this size always fits name of any flag enum value.
+template <typename E>
+[[nodiscard]] constexpr auto enum_flags_name_max_size() noexcept -> detail::enable_if_t<E, std::size_t> {
+  using D = std::decay_t<E>;
+  constexpr auto S = detail::enum_subtype::flags;
+  static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
+
+  return detail::flags_name_max_size<D, S>();
+}
+
+// Writes name of flag enum value to output iterator, char_type pointer and buffer use sized overloads below.
+// Returns iterator past the last written character, nothing is written if flag enum value has no name or is out of range.
+template <typename E, typename OutputIt, std::enable_if_t<!std::is_same_v<OutputIt, char_type*> && !detail::is_char_buffer<OutputIt>::value, int> = 0>
+constexpr auto enum_flags_name_to(OutputIt out, E value, char_type sep = char_type{'|'}) -> detail::enable_if_t<E, OutputIt> {
+  using D = std::decay_t<E>;
+  using U = underlying_type_t<D>;
+  constexpr auto S = detail::enum_subtype::flags;
+  static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
+
+  if (detail::flags_name_size<D, S>(static_cast<U>(value)) == 0) {
+    return out; // Invalid value or out of range.
+  }
+  return detail::write_flags_name<D, S>(out, static_cast<U>(value), sep);
+}
+
+// Writes name of flag enum value to buffer of given size, without null terminator.
+// Returns written length, or 0 if flag enum value has no name, is out of range or buffer is too small.
+template <typename E>
+constexpr auto enum_flags_name_to(char_type* buffer, std::size_t size, E value, char_type sep = char_type{'|'}) noexcept -> detail::enable_if_t<E, std::size_t> {
+  using D = std::decay_t<E>;
+  using U = underlying_type_t<D>;
+  constexpr auto S = detail::enum_subtype::flags;
+  static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
+
+  const auto n = detail::flags_name_size<D, S>(static_cast<U>(value));
+  if (n == 0 || n > size) {
+    return 0; // Invalid value, out of range or buffer is too small.
+  }
+  detail::write_flags_name<D, S>(buffer, static_cast<U>(value), sep);
+  return n;
+}
+
+// Writes name of flag enum value to contiguous buffer (std::span<char_type>, std::array<char_type, N>, char_type[N]), without null terminator.
+// Returns written length, or 0 if flag enum value has no name, is out of range or buffer is too small.
+template <typename E, typename Buffer, std::enable_if_t<detail::is_char_buffer<std::remove_reference_t<Buffer>>::value, int> = 0>
+constexpr auto enum_flags_name_to(Buffer&& buffer, E value, char_type sep = char_type{'|'}) noexcept -> detail::enable_if_t<E, std::size_t> {
+  return enum_flags_name_to<E>(std::data(buffer), std::size(buffer), value, sep);
+}
+
 // Returns name from flag enum value.
 // If flag enum value has no name or is out of range, returns empty string.
 template <typename E>
@@ -61,26 +276,27 @@ template <typename E>
   constexpr auto S = detail::enum_subtype::flags;
   static_assert(detail::is_reflected_v<D, S>, "magic_enum requires enum implementation and valid max and min.");
 
-  string name;
-  auto check_value = U{0};
-  for (std::size_t i = 0; i < detail::count_v<D, S>; ++i) {
-    if (const auto v = static_cast<U>(enum_value<D, S>(i)); (static_cast<U>(value) & v) != 0) {
-      if (const auto n = detail::names_v<D, S>[i]; !n.empty()) {
-        check_value |= v;
-        if (!name.empty()) {
-          name.append(1, sep);
-        }
-        name.append(n.data(), n.size());
-      } else {
-        return {}; // Value out of range.
-      }
+  if constexpr (detail::has_flags_name_cache_v<D, S>) {
+    if (sep == char_type{'|'}) {
+      const auto name = detail::cached_flags_name<D, S>(static_cast<U>(value));
+      return {name.data(), name.size()};
     }
   }
 
-  if (check_value != 0 && check_value == static_cast<U>(value)) {
-    return name;
+  if (static_cast<U>(value) == 0 || (static_cast<U>(value) & ~detail::values_ors<D, S>()) != 0) {
+    return {}; // Invalid value or out of range.
   }
-  return {}; // Invalid value or out of range.
+
+  string name;
+  detail::for_each_flag<D, S>(static_cast<U>(value), [&name, sep](std::size_t i) {
+    if (!name.empty()) {
+      name.append(1, sep);
+    }
+    const auto n = detail::name_at<D, S>(i);
+    name.append(n.data(), n.size());
+  });
+
+  return name;
 }
 
 // Returns flag enum value from integer value.
@@ -121,11 +337,18 @@ template <typename E, typename BinaryPredicate = std::equal_to<>>
       const auto d = detail::find(value, sep);
       const auto s = (d == string_view::npos) ? value : value.substr(0, d);
       auto f = U{0};
-      for (std::size_t i = 0; i < detail::count_v<D, S>; ++i) {
-        if (detail::cmp_equal(s, detail::names_v<D, S>[i], p)) {
-          f = static_cast<U>(enum_value<D, S>(i));
+      if constexpr (detail::has_name_hash<D, S, BinaryPredicate>()) {
+        if (const auto i = detail::find_name<D, S>(s, p)) {
+          f = static_cast<U>(enum_value<D, S>(i - 1));
           result |= f;
-          break;
+        }
+      } else {
+        for (std::size_t i = 0; i < detail::count_v<D, S>; ++i) {
+          if (detail::cmp_equal(s, detail::name_at<D, S>(i), p)) {
+            f = static_cast<U>(enum_value<D, S>(i));
+            result |= f;
+            break;
+          }
         }
       }
       if (f == U{0}) {
@@ -184,6 +407,75 @@ constexpr auto enum_flags_test_any(E lhs, E rhs) noexcept -> detail::enable_if_t
   return (static_cast<U>(lhs) & static_cast<U>(rhs)) != 0;
 }
 
+// Flag enum value shared between threads, read-modify-write operations are single atomic instructions.
+// Flags outside of reflected values are rejected by assertion and dropped, so value always stays valid combination.
+template <typename E>
+class atomic_flags {
+  static_assert(is_flags_v<E>, "magic_enum::atomic_flags requires flag enum.");
+
+  using U = underlying_type_t<E>;
+
+  static constexpr U mask = detail::values_ors<E, detail::enum_subtype::flags>();
+
+  [[nodiscard]] static constexpr U valid(E flags) noexcept {
+    MAGIC_ENUM_ASSERT((static_cast<U>(flags) & ~mask) == 0);
+    return static_cast<U>(static_cast<U>(flags) & mask);
+  }
+
+ public:
+  using value_type = E;
+
+  static constexpr bool is_always_lock_free = std::atomic<U>::is_always_lock_free;
+
+  constexpr atomic_flags() noexcept : v{U{0}} {}
+
+  constexpr explicit atomic_flags(E flags) noexcept : v{valid(flags)} {}
+
+  atomic_flags(const atomic_flags&) = delete;
+  atomic_flags& operator=(const atomic_flags&) = delete;
+
+  [[nodiscard]] E load(std::memory_order order = std::memory_order_seq_cst) const noexcept { return static_cast<E>(v.load(order)); }
+
+  void store(E flags, std::memory_order order = std::memory_order_seq_cst) noexcept { v.store(valid(flags), order); }
+
+  E exchange(E flags, std::memory_order order = std::memory_order_seq_cst) noexcept { return static_cast<E>(v.exchange(valid(flags), order)); }
+
+  // Sets flags and returns previous value.
+  E fetch_set(E flags, std::memory_order order = std::memory_order_seq_cst) noexcept { return static_cast<E>(v.fetch_or(valid(flags), order)); }
+
+  // Clears flags and returns previous value.
+  E fetch_clear(E flags, std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return static_cast<E>(v.fetch_and(static_cast<U>(~valid(flags)), order));
+  }
+
+  // Same semantics as enum_flags_test_any, false if flags equals 0.
+  [[nodiscard]] bool test_any(E flags, std::memory_order order = std::memory_order_seq_cst) const noexcept { return enum_flags_test_any(load(order), flags); }
+
+  // Same semantics as enum_flags_test, false if flags equals 0.
+  [[nodiscard]] bool test_all(E flags, std::memory_order order = std::memory_order_seq_cst) const noexcept { return enum_flags_test(load(order), flags); }
+
+#if defined(__cpp_lib_atomic_wait) && __cpp_lib_atomic_wait >= 201907L
+  // Blocks until any of flags is set and returns value that satisfied it. Writers must call notify_one or notify_all.
+  E wait_for_any(E flags, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    const auto f = valid(flags);
+    MAGIC_ENUM_ASSERT(f != 0);
+    auto current = v.load(order);
+    while ((current & f) == 0) {
+      v.wait(current, order);
+      current = v.load(order);
+    }
+    return static_cast<E>(current);
+  }
+
+  void notify_one() noexcept { v.notify_one(); }
+
+  void notify_all() noexcept { v.notify_all(); }
+#endif
+
+ private:
+  std::atomic<U> v;
+};
+
 } // namespace magic_enum
 
 #endif // NEARGYE_MAGIC_ENUM_FLAGS_HPP
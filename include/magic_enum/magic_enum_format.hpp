@@ -35,24 +35,210 @@
 #include "magic_enum.hpp"
 #include "magic_enum_flags.hpp"
 
+#ifndef MAGIC_ENUM_USE_STD_MODULE
+#  include <charconv>
+#endif
+
+#if !defined(MAGIC_ENUM_NO_EXCEPTION) && (defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND))
+#  define MAGIC_ENUM_FORMAT_THROW(...) throw (__VA_ARGS__)
+#else
+#  ifndef MAGIC_ENUM_USE_STD_MODULE
+#    include <cstdlib>
+#  endif
+#  define MAGIC_ENUM_FORMAT_THROW(...) std::abort()
+#endif
+
 namespace magic_enum::detail {
 
-template <typename E, std::enable_if_t<std::is_enum_v<std::decay_t<E>>, int> = 0>
-std::string format_as(E e) {
+// Presentation of enum formatter, parsed from trailing type of format spec [[fill]align][width][.precision][type]:
+// n (default) name, d decimal underlying integer, x hexadecimal underlying integer, t name qualified by enum_type_name, f[sep] flag names joined with sep.
+struct format_spec {
+  char type = 'n';
+  char sep = '|';
+};
+
+// Returns end of format spec that starts at first, skipping nested dynamic width and precision fields.
+template <typename It>
+constexpr It format_spec_end(It first, It last) noexcept {
+  std::size_t depth = 0;
+  for (; first != last; ++first) {
+    if (*first == '{') {
+      ++depth;
+    } else if (*first == '}') {
+      if (depth == 0) {
+        break;
+      }
+      --depth;
+    }
+  }
+  return first;
+}
+
+constexpr bool is_format_align(char c) noexcept {
+  return c == '<' || c == '>' || c == '^';
+}
+
+// Strips trailing presentation type from format spec [first, last) into spec, returns end of remaining fill, align, width and precision.
+// Spec of two characters f followed by align is fill and align, as in {:f<}, separator that is align character needs explicit align before f, as in {:<f<}.
+template <typename It>
+constexpr It parse_format_type(It first, It last, format_spec& spec) noexcept {
+  const auto size = last - first;
+  if (size >= 2 && *(last - 2) == 'f' && *(last - 1) != '{' && !(size == 2 && is_format_align(*(last - 1)))) {
+    spec.type = 'f';
+    spec.sep = *(last - 1);
+    return last - 2;
+  }
+  if (size >= 1) {
+    if (const char type = *(last - 1); type == 'n' || type == 'd' || type == 'x' || type == 't' || type == 'f') {
+      spec.type = type;
+      return last - 1;
+    }
+  }
+  return last;
+}
+
+// Returns error message if fill, align, width and precision [first, last) before presentation type are not supported, otherwise nullptr.
+template <typename It>
+constexpr const char* check_format_spec(It first, It last, format_spec spec) noexcept {
+  auto it = first;
+  if (last - first >= 2 && is_format_align(*(first + 1))) {
+    it = first + 2;
+  } else if (first != last && is_format_align(*first)) {
+    it = first + 1;
+  }
+  for (; it != last; ++it) {
+    if (*it == '{') {
+      // Remaining spec is parsed by separate context, which can not refer to format arguments.
+      return "magic_enum::formatter does not support dynamic width or precision with presentation type.";
+    }
+    if (*it == '.' && (spec.type == 'd' || spec.type == 'x')) {
+      return "magic_enum::formatter does not support precision with integer presentation type.";
+    }
+  }
+  return nullptr;
+}
+
+// Size of buffer that fits formatted value of any enum value in any presentation.
+template <typename E>
+constexpr std::size_t format_buffer_size() noexcept {
+  using D = std::decay_t<E>;
+  constexpr std::size_t integer_size = std::numeric_limits<unsigned long long>::digits10 + 2;
+  std::size_t size = integer_size;
+  if constexpr (magic_enum::detail::supported<D>::value) {
+    constexpr auto S = magic_enum::detail::subtype_v<D>;
+    const std::size_t prefix_size = magic_enum::enum_type_name<D>().size() + 2;
+    std::size_t name_size = 0;
+    for (std::size_t i = 0; i < magic_enum::detail::count_v<D, S>; ++i) {
+      const auto n = magic_enum::detail::names_v<D, S>[i].size() + prefix_size;
+      if constexpr (S == magic_enum::detail::enum_subtype::flags) {
+        name_size += n + (i > 0 ? 1 : 0);
+      } else {
+        name_size = n > name_size ? n : name_size;
+      }
+    }
+    size = name_size > size ? name_size : size;
+  }
+  return size;
+}
+
+template <typename E>
+using format_buffer = std::array<char, format_buffer_size<E>()>;
+
+template <typename E>
+string_view format_integer(E e, char* first, char* last, int base = 10) noexcept {
   using D = std::decay_t<E>;
+  using U = underlying_type_t<D>;
+  std::to_chars_result result{};
+  if constexpr (std::is_same_v<U, bool>) {
+    result = std::to_chars(first, last, static_cast<unsigned>(e), base);
+  } else if (base == 10) {
+    using I = std::conditional_t<std::is_signed_v<U>, long long, unsigned long long>;
+    result = std::to_chars(first, last, static_cast<I>(static_cast<U>(e)), base);
+  } else {
+    // Bit pattern of underlying value, as flags are usually read in hexadecimal.
+    result = std::to_chars(first, last, static_cast<unsigned long long>(static_cast<std::make_unsigned_t<U>>(static_cast<U>(e))), base);
+  }
+  return {first, static_cast<std::size_t>(result.ptr - first)};
+}
+
+template <typename OutputIt>
+OutputIt format_copy(OutputIt out, string_view s) {
+  for (const auto c : s) {
+    *out++ = c;
+  }
+  return out;
+}
+
+// Writes formatted value of enum value straight to output iterator: names one by one, flag names with separator between them, otherwise underlying integer.
+template <typename E, typename OutputIt, std::enable_if_t<std::is_enum_v<std::decay_t<E>>, int> = 0>
+OutputIt format_name_to(OutputIt out, E e, format_spec spec = {}) {
+  using D = std::decay_t<E>;
+  using U = underlying_type_t<D>;
   static_assert(std::is_same_v<char, magic_enum::string_view::value_type>, "magic_enum::formatter requires string_view::value_type type same as char.");
+  char buffer[std::numeric_limits<unsigned long long>::digits10 + 2];
+  if (spec.type == 'd' || spec.type == 'x') {
+    return format_copy(out, format_integer<D>(e, buffer, buffer + sizeof(buffer), spec.type == 'x' ? 16 : 10));
+  }
   if constexpr (magic_enum::detail::supported<D>::value) {
+    const auto write_name = [spec](OutputIt o, string_view name) {
+      if (spec.type == 't') {
+        o = format_copy(o, magic_enum::enum_type_name<D>());
+        *o++ = ':';
+        *o++ = ':';
+      }
+      return format_copy(o, name);
+    };
     if constexpr (magic_enum::detail::subtype_v<D> == magic_enum::detail::enum_subtype::flags) {
-      if (const auto name = magic_enum::enum_flags_name<D>(e); !name.empty()) {
-        return {name.data(), name.size()};
+      constexpr auto S = magic_enum::detail::enum_subtype::flags;
+      if constexpr (magic_enum::detail::has_flags_name_cache_v<D, S>) {
+        if (spec.type == 'n' || (spec.type == 'f' && spec.sep == '|')) {
+          if (const auto name = magic_enum::enum_flags_name_view<D>(e); !name.empty()) {
+            return format_copy(out, name);
+          }
+        }
+      }
+      if (magic_enum::detail::flags_name_size<D, S>(static_cast<U>(e)) != 0) {
+        const char sep = spec.type == 'f' ? spec.sep : '|';
+        bool first = true;
+        magic_enum::detail::for_each_flag<D, S>(static_cast<U>(e), [&out, &first, &write_name, sep](std::size_t i) {
+          if (!first) {
+            *out++ = sep;
+          }
+          first = false;
+          out = write_name(out, magic_enum::detail::name_at<D, S>(i));
+        });
+        return out;
       }
     } else {
       if (const auto name = magic_enum::enum_name<D>(e); !name.empty()) {
-        return {name.data(), name.size()};
+        return write_name(out, name);
+      }
+    }
+  }
+  return format_copy(out, format_integer<D>(e, buffer, buffer + sizeof(buffer)));
+}
+
+// Returns formatted value of enum value without allocation, view points to name or into buffer.
+template <typename E, std::enable_if_t<std::is_enum_v<std::decay_t<E>>, int> = 0>
+string_view format_name(E e, format_buffer<E>& buffer, format_spec spec = {}) noexcept {
+  using D = std::decay_t<E>;
+  if constexpr (magic_enum::detail::supported<D>::value) {
+    if constexpr (magic_enum::detail::subtype_v<D> == magic_enum::detail::enum_subtype::flags) {
+      if constexpr (magic_enum::detail::has_flags_name_cache_v<D, magic_enum::detail::enum_subtype::flags>) {
+        if (spec.type == 'n' || (spec.type == 'f' && spec.sep == '|')) {
+          if (const auto name = magic_enum::enum_flags_name_view<D>(e); !name.empty()) {
+            return name;
+          }
+        }
+      }
+    } else if (spec.type == 'n' || spec.type == 'f') {
+      if (const auto name = magic_enum::enum_name<D>(e); !name.empty()) {
+        return name;
       }
     }
   }
-  return std::to_string(magic_enum::enum_integer<D>(e));
+  const auto last = format_name_to(buffer.data(), e, spec);
+  return {buffer.data(), static_cast<std::size_t>(last - buffer.data())};
 }
 
 } // namespace magic_enum::detail
@@ -65,11 +251,14 @@ std::string format_as(E e) {
 
 #if defined(__cpp_lib_format) && __cpp_lib_format >= 201907L
 
+// Format spec is parsed by string_view formatter, presentation type is supported by fmt::formatter only.
 template <typename E>
 struct std::formatter<E, std::enable_if_t<std::is_enum_v<std::decay_t<E>>, char>> : std::formatter<std::string_view, char> {
   template <typename FormatContext>
   auto format(E e, FormatContext& ctx) const {
-    return std::formatter<std::string_view, char>::format(magic_enum::detail::format_as<E>(e), ctx);
+    magic_enum::detail::format_buffer<E> buffer;
+    const auto name = magic_enum::detail::format_name<E>(e, buffer);
+    return std::formatter<std::string_view, char>::format(std::string_view{name.data(), name.size()}, ctx);
   }
 };
 
@@ -79,12 +268,48 @@ struct std::formatter<E, std::enable_if_t<std::is_enum_v<std::decay_t<E>>, char>
 
 template <typename E>
 struct fmt::formatter<E, std::enable_if_t<std::is_enum_v<std::decay_t<E>>, char>> : fmt::formatter<std::string_view, char> {
+  template <typename ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    const auto last = magic_enum::detail::format_spec_end(ctx.begin(), ctx.end());
+    const auto base_last = magic_enum::detail::parse_format_type(ctx.begin(), last, spec);
+    plain = ctx.begin() == base_last;
+    if (base_last == last) {
+      return fmt::formatter<std::string_view, char>::parse(ctx);
+    }
+    if (!plain) {
+      // Fill, align, width and precision before presentation type are parsed by string_view formatter.
+      if (const auto error = magic_enum::detail::check_format_spec(ctx.begin(), base_last, spec)) {
+        // Reported through fmt error handler, which needs only fmt/core.h (fmt/base.h since fmt 11).
+#  if FMT_VERSION >= 110000
+        fmt::report_error(error);
+#  else
+        ctx.on_error(error);
+#  endif
+      }
+      fmt::format_parse_context base_ctx{fmt::string_view{ctx.begin(), static_cast<std::size_t>(base_last - ctx.begin())}};
+      fmt::formatter<std::string_view, char>::parse(base_ctx);
+    }
+    return last;
+  }
+
   template <typename FormatContext>
   auto format(E e, FormatContext& ctx) const {
-    return fmt::formatter<std::string_view, char>::format(magic_enum::detail::format_as<E>(e), ctx);
+    if (plain) {
+      return magic_enum::detail::format_name_to(ctx.out(), e, spec);
+    }
+    magic_enum::detail::format_buffer<E> buffer;
+    const auto name = magic_enum::detail::format_name<E>(e, buffer, spec);
+    return fmt::formatter<std::string_view, char>::format(std::string_view{name.data(), name.size()}, ctx);
   }
+
+ private:
+  magic_enum::detail::format_spec spec;
+  // Without fill, align, width and precision nothing is padded, so value is written straight to output.
+  bool plain = true;
 };
 
 #endif
 
+#undef MAGIC_ENUM_FORMAT_THROW
+
 #endif // NEARGYE_MAGIC_ENUM_FORMAT_HPP
@@ -34,6 +34,10 @@
 
 #include "magic_enum.hpp"
 
+#ifndef MAGIC_ENUM_USE_STD_MODULE
+#  include <tuple>
+#endif
+
 namespace magic_enum {
 
 namespace detail {
@@ -73,6 +77,42 @@ constexpr auto typesafe_fuse_enum(Es... values) noexcept {
   return optional<enum_fuse_t>{};
 }
 
+template <typename... Es>
+constexpr bool fuse_dense_fits() noexcept {
+  constexpr std::size_t counts[] = {enum_count<Es>()...};
+  std::size_t size = 1;
+  for (const auto count : counts) {
+    if (count != 0 && size > (std::numeric_limits<std::size_t>::max)() / count) {
+      return false;
+    }
+    size *= count;
+  }
+
+  return true;
+}
+
+template <typename E>
+constexpr optional<std::size_t> fuse_dense_one(optional<std::size_t> key, E value) noexcept {
+  if (key) {
+    if (const auto index = enum_index(value)) {
+      return *key * enum_count<E>() + *index;
+    }
+  }
+  return {};
+}
+
+template <typename... Es, std::size_t... I>
+constexpr std::tuple<Es...> unfuse_dense(std::size_t key, std::index_sequence<I...>) noexcept {
+  constexpr std::size_t counts[] = {enum_count<Es>()...};
+  std::size_t strides[sizeof...(Es)] = {};
+  for (std::size_t i = sizeof...(Es), stride = 1; i-- > 0;) {
+    strides[i] = stride;
+    stride *= counts[i];
+  }
+
+  return std::tuple<Es...>{enum_value<Es>(key / strides[I] % counts[I])...};
+}
+
 } // namespace magic_enum::detail
 
 // Returns a bijective mix of several enum values. This can be used to emulate 2D switch/case statements.
@@ -89,6 +129,33 @@ template <typename... Es>
   return MAGIC_ENUM_ASSERT(fuse), fuse;
 }
 
+// Returns a dense mix of several enum values in [0, enum_count<E1>() * enum_count<E2>() * ...), first value is the most significant digit.
+// Unlike enum_fuse there are no holes, so key can index flat multi-dimensional table.
+template <typename... Es>
+[[nodiscard]] constexpr auto enum_fuse_dense(Es... values) noexcept -> optional<std::size_t> {
+  static_assert((std::is_enum_v<std::decay_t<Es>> && ...), "magic_enum::enum_fuse_dense requires enum type.");
+  static_assert(sizeof...(Es) >= 2, "magic_enum::enum_fuse_dense requires at least 2 values.");
+  static_assert(detail::fuse_dense_fits<std::decay_t<Es>...>(), "magic_enum::enum_fuse_dense does not work for large enums");
+
+  auto fuse = optional<std::size_t>{0};
+  ((fuse = detail::fuse_dense_one<std::decay_t<Es>>(fuse, values)), ...);
+  return MAGIC_ENUM_ASSERT(fuse), fuse;
+}
+
+// Returns tuple of enum values from key of enum_fuse_dense.
+// If key is out of range, returns empty optional.
+template <typename... Es>
+[[nodiscard]] constexpr auto enum_unfuse(std::size_t key) noexcept -> optional<std::tuple<Es...>> {
+  static_assert((std::is_enum_v<Es> && ...), "magic_enum::enum_unfuse requires enum type.");
+  static_assert(sizeof...(Es) >= 2, "magic_enum::enum_unfuse requires at least 2 values.");
+  static_assert(detail::fuse_dense_fits<Es...>(), "magic_enum::enum_unfuse does not work for large enums");
+
+  if (key < (enum_count<Es>() * ...)) {
+    return detail::unfuse_dense<Es...>(key, std::index_sequence_for<Es...>{});
+  }
+  return {}; // Key out of range.
+}
+
 } // namespace magic_enum
 
 #endif // NEARGYE_MAGIC_ENUM_FUSE_HPP
@@ -67,12 +67,8 @@ constexpr auto common_invocable(std::index_sequence<J...>) noexcept {
   }
 }
 
-template <typename E, enum_subtype S, typename Result, typename F>
-constexpr auto result_type() noexcept {
-  static_assert(std::is_enum_v<E>, "magic_enum::detail::result_type requires enum type.");
-
-  constexpr auto seq = std::make_index_sequence<count_v<E, S>>{};
-  using R = typename decltype(common_invocable<E, S, F>(seq))::type;
+template <typename Result, typename R>
+constexpr auto select_result() noexcept {
   if constexpr (std::is_same_v<Result, default_result_type>) {
     if constexpr (std::is_same_v<R, nonesuch>) {
       return identity<void>{};
@@ -90,6 +86,15 @@ constexpr auto result_type() noexcept {
   }
 }
 
+template <typename E, enum_subtype S, typename Result, typename F>
+constexpr auto result_type() noexcept {
+  static_assert(std::is_enum_v<E>, "magic_enum::detail::result_type requires enum type.");
+
+  constexpr auto seq = std::make_index_sequence<count_v<E, S>>{};
+  using R = typename decltype(common_invocable<E, S, F>(seq))::type;
+  return select_result<Result, R>();
+}
+
 template <typename E, enum_subtype S, typename Result, typename F, typename D = std::decay_t<E>, typename R = typename decltype(result_type<D, S, Result, F>())::type>
 using result_t = std::enable_if_t<std::is_enum_v<D> && !std::is_same_v<R, nonesuch>, R>;
 
@@ -101,36 +106,140 @@ inline constexpr auto default_result_type_lambda = []() noexcept(std::is_nothrow
 template <>
 inline constexpr auto default_result_type_lambda<void> = []() noexcept {};
 
-template <std::size_t J, std::size_t End, typename R, typename E, enum_subtype S, typename F, typename Def>
-constexpr decltype(auto) constexpr_switch_impl(F&& f, E value, Def&& def) {
-  if constexpr (J < End) {
-    constexpr auto v = enum_constant<enum_value<E, J, S>()>{};
-    if (value == v) {
-      if constexpr (std::is_invocable_r_v<R, F, decltype(v)>) {
-        return static_cast<R>(std::forward<F>(f)(v));
-      } else {
-        return def();
-      }
-    } else {
-      return constexpr_switch_impl<J + 1, End, R, E, S>(std::forward<F>(f), value, std::forward<Def>(def));
-    }
+template <typename R, typename E, enum_subtype S, std::size_t J, typename F, typename Def>
+constexpr R switch_case(F&& f, Def&& def) {
+  constexpr auto v = enum_constant<values_v<E, S>[J]>{};
+  if constexpr (std::is_invocable_r_v<R, F, decltype(v)>) {
+    return static_cast<R>(std::forward<F>(f)(v));
   } else {
     return def();
   }
 }
 
+// Table of cases indexed by enum_index, so dispatch is one index lookup and one indirect call instead of chain of compares.
+template <typename R, typename E, enum_subtype S, typename F, typename Def, typename = std::make_index_sequence<count_v<E, S>>>
+struct switch_table;
+
+template <typename R, typename E, enum_subtype S, typename F, typename Def, std::size_t... J>
+struct switch_table<R, E, S, F, Def, std::index_sequence<J...>> {
+  static constexpr R (*cases[])(F&&, Def&&) = {&switch_case<R, E, S, J, F, Def>...};
+};
+
 template <typename R, typename E, enum_subtype S, typename F, typename Def>
 constexpr decltype(auto) constexpr_switch(F&& f, E value, Def&& def) {
   static_assert(is_enum_v<E>, "magic_enum::detail::constexpr_switch requires enum type.");
 
   if constexpr (count_v<E, S> == 0) {
+    static_cast<void>(value);
     return def();
   } else {
-    return constexpr_switch_impl<0, count_v<E, S>, R, E, S>(std::forward<F>(f), value, std::forward<Def>(def));
+    if (const auto i = enum_index<E, S>(value)) {
+      return switch_table<R, E, S, F, Def>::cases[*i](std::forward<F>(f), std::forward<Def>(def));
+    }
+    return def();
   }
 }
 #endif
 
+template <bool, typename F, typename... Vs>
+struct invoke_result_n : identity<nonesuch> {};
+
+template <typename F, typename... Vs>
+struct invoke_result_n<true, F, Vs...> : std::invoke_result<F, Vs...> {};
+
+// Dispatch over several enums, combination index J is fused index of values with first enum as most significant digit.
+template <typename... Es>
+struct fused_switch {
+  static constexpr std::size_t counts[] = {count_v<Es, subtype_v<Es>>...};
+  static constexpr std::size_t size = (std::size_t{1} * ... * count_v<Es, subtype_v<Es>>);
+
+  // Returns index of value of I-th enum in combination J.
+  template <std::size_t J, std::size_t I>
+  static constexpr std::size_t digit() noexcept {
+    auto j = J;
+    for (auto k = sizeof...(Es) - 1; k > I; --k) {
+      j /= counts[k];
+    }
+
+    return j % counts[I];
+  }
+
+  template <typename F, std::size_t J, std::size_t... I>
+  static constexpr auto invoke_result(std::index_sequence<I...>) noexcept {
+    return invoke_result_n<std::is_invocable_v<F, enum_constant<values_v<Es, subtype_v<Es>>[digit<J, I>()]>...>, F, enum_constant<values_v<Es, subtype_v<Es>>[digit<J, I>()]>...>{};
+  }
+
+  template <typename F, std::size_t... J>
+  static constexpr auto common_invocable(std::index_sequence<J...>) noexcept {
+    if constexpr (size == 0) {
+      return identity<nonesuch>{};
+    } else {
+      return std::common_type<typename decltype(invoke_result<F, J>(std::index_sequence_for<Es...>{}))::type...>{};
+    }
+  }
+
+  template <typename R, std::size_t J, typename F, typename Def, std::size_t... I>
+  static constexpr R call(F&& f, Def&& def, std::index_sequence<I...>) {
+    if constexpr (std::is_invocable_r_v<R, F, enum_constant<values_v<Es, subtype_v<Es>>[digit<J, I>()]>...>) {
+      return static_cast<R>(std::forward<F>(f)(enum_constant<values_v<Es, subtype_v<Es>>[digit<J, I>()]>{}...));
+    } else {
+      return def();
+    }
+  }
+
+  template <typename R, std::size_t J, typename F, typename Def>
+  static constexpr R call(F&& f, Def&& def) {
+    return call<R, J>(std::forward<F>(f), std::forward<Def>(def), std::index_sequence_for<Es...>{});
+  }
+
+  template <typename R, typename F, typename Def, std::size_t... J>
+  static constexpr auto table(std::index_sequence<J...>) noexcept {
+    return std::array<R (*)(F&&, Def&&), sizeof...(J)>{{&call<R, J, F, Def>...}};
+  }
+
+  template <typename R, typename F, typename Def>
+  static constexpr auto table_v = table<R, F, Def>(std::make_index_sequence<size>{});
+};
+
+template <typename Result, typename F, typename... Es>
+constexpr auto fused_result_type() noexcept {
+  using R = typename decltype(fused_switch<Es...>::template common_invocable<F>(std::make_index_sequence<fused_switch<Es...>::size>{}))::type;
+  return select_result<Result, R>();
+}
+
+template <bool, typename Result, typename F, typename... Es>
+struct fused_result {};
+
+template <typename Result, typename F, typename... Es>
+struct fused_result<true, Result, F, Es...> : std::enable_if<!std::is_same_v<typename decltype(fused_result_type<Result, F, std::decay_t<Es>...>())::type, nonesuch>, typename decltype(fused_result_type<Result, F, std::decay_t<Es>...>())::type> {};
+
+template <typename Result, typename F, typename... Es>
+using fused_result_t = typename fused_result<(std::is_enum_v<std::decay_t<Es>> && ...), Result, F, Es...>::type;
+
+template <typename R, typename F, typename Def, typename... Es>
+constexpr decltype(auto) fused_switch_call(F&& f, Def&& def, Es... values) {
+  static_assert((is_reflected_v<Es, subtype_v<Es>> && ...), "magic_enum requires enum implementation and valid max and min.");
+
+  if constexpr (fused_switch<Es...>::size == 0) {
+    ((static_cast<void>(values)), ...);
+    return def();
+  } else {
+    std::size_t j = 0;
+    const auto valid = ([&j](auto value) {
+      using D = decltype(value);
+      if (const auto i = enum_index<D, subtype_v<D>>(value)) {
+        j = j * count_v<D, subtype_v<D>> + *i;
+        return true;
+      }
+      return false;
+    }(values) && ...);
+    if (valid) {
+      return fused_switch<Es...>::template table_v<R, F, Def>[j](std::forward<F>(f), std::forward<Def>(def));
+    }
+    return def();
+  }
+}
+
 } // namespace magic_enum::detail
 
 template <typename Result = detail::default_result_type, typename E, detail::enum_subtype S = detail::subtype_v<E>, typename F, typename R = detail::result_t<E, S, Result, F>>
@@ -181,6 +290,18 @@ constexpr decltype(auto) enum_switch(F&& f, E value, Result&& result) {
   return enum_switch<Result, E, S>(std::forward<F>(f), value, std::forward<Result>(result));
 }
 
+// Calls callable with enum_constant of each value, e.g. f(enum_constant<A>{}, enum_constant<B>{}), through one table of all combinations of values.
+// If any value is invalid or callable is not invocable with combination, returns default-constructed result.
+template <typename Result = detail::default_result_type, typename F, typename E1, typename E2, typename... Es, typename R = detail::fused_result_t<Result, F, E1, E2, Es...>>
+constexpr decltype(auto) enum_switch(F&& f, E1 value1, E2 value2, Es... values) {
+  return detail::fused_switch_call<R>(
+      std::forward<F>(f),
+      detail::default_result_type_lambda<R>,
+      value1,
+      value2,
+      values...);
+}
+
 } // namespace magic_enum
 
 template <>
@@ -133,15 +133,22 @@ namespace bitwise_operators {
 #ifndef MAGIC_ENUM_USING_ALIAS_STRING
 namespace containers {
   using containers::array;
+  using containers::atomic_bitset;
   using containers::bitset;
   using containers::comparator_indexing;
+  using containers::counter_array;
   using containers::default_indexing;
+  using containers::flat_map;
   using containers::get;
   using containers::make_array;
+  using containers::map;
+  using containers::matrix;
   using containers::name_greater;
   using containers::name_greater_case_insensitive;
   using containers::name_less;
   using containers::name_less_case_insensitive;
+  using containers::packed;
+  using containers::padded;
   using containers::raw_access;
   using containers::set;
   using containers::to_array;
@@ -156,6 +163,7 @@ using magic_enum::is_magic_enum_supported;
 using magic_enum::Enum;
 using magic_enum::enum_name;
 using magic_enum::enum_cast;
+using magic_enum::enum_cast_batch;
 using magic_enum::enum_value;
 using magic_enum::enum_values;
 using magic_enum::enum_count;
@@ -164,6 +172,8 @@ using magic_enum::enum_underlying;
 using magic_enum::enum_names;
 using magic_enum::enum_entries;
 using magic_enum::enum_fuse;
+using magic_enum::enum_fuse_dense;
+using magic_enum::enum_unfuse;
 using magic_enum::enum_switch;
 using magic_enum::enum_for_each;
 using magic_enum::enum_contains;
@@ -174,9 +184,13 @@ using magic_enum::enum_next_value;
 using magic_enum::enum_next_value_circular;
 using magic_enum::enum_constant;
 using magic_enum::enum_flags_name;
+using magic_enum::enum_flags_name_to;
+using magic_enum::enum_flags_name_view;
+using magic_enum::enum_flags_name_max_size;
 using magic_enum::enum_flags_contains;
 using magic_enum::enum_flags_test;
 using magic_enum::enum_flags_test_any;
+using magic_enum::atomic_flags;
 using magic_enum::enum_flags_cast;
 using magic_enum::enum_type_name;
 using magic_enum::enum_reflected;
@@ -15,6 +15,10 @@
 #include <magic_enum/magic_enum_switch.hpp>
 #include <magic_enum/magic_enum_utility.hpp>
 
+#if defined(MAGIC_ENUM_SIMD_SSE2) || defined(MAGIC_ENUM_SIMD_AVX2) || defined(MAGIC_ENUM_IS_CONSTANT_EVALUATED)
+#  error Internal macro leaked from magic_enum.hpp.
+#endif
+
 #include "test_helpers.hpp"
 
 #include <array>
@@ -69,6 +73,25 @@ enum class hash_case_collision {
   E7DvAyiJL6
 };
 
+enum class perfect_hash_collision {
+  AB_X,
+  AC_X,
+  AD_X
+};
+
+enum class perfect_hash_case {
+  value,
+  VALUE,
+  Other
+};
+
+enum class perfect_hash_wide {
+  v00, v01, v02, v03, v04, v05, v06, v07, v08, v09, v10, v11, v12, v13, v14, v15,
+  v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31,
+  v32, v33, v34, v35, v36, v37, v38, v39, v40, v41, v42, v43, v44, v45, v46, v47,
+  v48, v49, v50, v51, v52, v53, v54, v55, v56, v57, v58, v59, v60, v61, v62, v63
+};
+
 enum class MaxUsedAsInvalid : std::uint8_t {
   ONE,
   TWO = 63,
@@ -127,8 +150,76 @@ struct magic_enum::customize::enum_range<CStyleEnum> {
 
 
 
+enum class SparseWide : std::int16_t {
+  m1000 = -1000,
+  m950 = -950,
+  m900 = -900,
+  m850 = -850,
+  m800 = -800,
+  m750 = -750,
+  m700 = -700,
+  m650 = -650,
+  m600 = -600,
+  m550 = -550,
+  m500 = -500,
+  m450 = -450,
+  m400 = -400,
+  m350 = -350,
+  m300 = -300,
+  m250 = -250,
+  m200 = -200,
+  m150 = -150,
+  m100 = -100,
+  m50 = -50,
+  p0 = 0,
+  p50 = 50,
+  p100 = 100,
+  p150 = 150,
+  p200 = 200,
+  p250 = 250,
+  p300 = 300,
+  p350 = 350,
+  p400 = 400,
+  p450 = 450,
+  p500 = 500,
+  p550 = 550,
+  p600 = 600,
+  p650 = 650,
+  p700 = 700,
+  p750 = 750,
+  p800 = 800,
+  p850 = 850,
+  p900 = 900,
+  p950 = 950,
+  p1000 = 1000
+};
+template <>
+struct magic_enum::customize::enum_range<SparseWide> {
+  static constexpr int min = -1000;
+  static constexpr int max = 1000;
+};
+
+template <typename T, int N>
+struct TemplateHolder {
+  enum class Nested { A = -100, B = 3, C = 100 };
+};
+
 enum class BoolTest : bool { Yay, Nay };
 
+enum class SmallDense : std::uint8_t { a, b, c };
+
+// Character literals in type name must not be taken as brackets of reflected signature.
+template <char C>
+struct CharHolder {
+  enum class Nested { a, b, c };
+};
+
+template <>
+struct magic_enum::customize::enum_range<CharHolder<'('>::Nested> {
+  static constexpr int min = 0;
+  static constexpr int max = 8;
+};
+
 using namespace magic_enum;
 using namespace magic_enum_tests;
 
@@ -211,6 +302,42 @@ TEST_CASE("enum_cast") {
     REQUIRE(enum_cast<hash_case_collision>("E7DvAyiJL6") == hash_case_collision::E7DvAyiJL6);
 
     REQUIRE(enum_cast<BoolTest>("Nay").has_value());
+    REQUIRE_FALSE(enum_cast<Color>("").has_value());
+  }
+
+  SUBCASE("perfect hash") {
+    constexpr auto ac = enum_cast<perfect_hash_collision>("AC_X");
+    REQUIRE(ac.value() == perfect_hash_collision::AC_X);
+    REQUIRE(enum_cast<perfect_hash_collision>("AB_X").value() == perfect_hash_collision::AB_X);
+    REQUIRE(enum_cast<perfect_hash_collision>("AD_X").value() == perfect_hash_collision::AD_X);
+    REQUIRE_FALSE(enum_cast<perfect_hash_collision>("AE_X").has_value());
+    REQUIRE_FALSE(enum_cast<perfect_hash_collision>("AB_").has_value());
+
+    constexpr auto round_trip = [] {
+      for (const auto v : enum_values<perfect_hash_wide>()) {
+        if (enum_cast<perfect_hash_wide>(enum_name(v)) != v) {
+          return false;
+        }
+      }
+      return true;
+    }();
+    REQUIRE(round_trip);
+    REQUIRE(enum_cast<perfect_hash_wide>("v42").value() == perfect_hash_wide::v42);
+    REQUIRE_FALSE(enum_cast<perfect_hash_wide>("v64").has_value());
+    REQUIRE_FALSE(enum_cast<perfect_hash_wide>("v4").has_value());
+    REQUIRE_FALSE(enum_cast<perfect_hash_wide>("v420").has_value());
+
+    constexpr auto ci = enum_cast<perfect_hash_collision>("ac_x", case_insensitive);
+    REQUIRE(ci.value() == perfect_hash_collision::AC_X);
+    REQUIRE(enum_cast<perfect_hash_collision>("aD_x", case_insensitive).value() == perfect_hash_collision::AD_X);
+    REQUIRE_FALSE(enum_cast<perfect_hash_collision>("ae_x", case_insensitive).has_value());
+    REQUIRE(enum_cast<perfect_hash_wide>("V63", case_insensitive).value() == perfect_hash_wide::v63);
+    REQUIRE(enum_contains<perfect_hash_wide>("V07", case_insensitive));
+    REQUIRE_FALSE(enum_contains<perfect_hash_wide>("V7", case_insensitive));
+
+    REQUIRE(enum_cast<perfect_hash_case>("VALUE").value() == perfect_hash_case::VALUE);
+    REQUIRE(enum_cast<perfect_hash_case>("VALUE", case_insensitive).value() == perfect_hash_case::value);
+    REQUIRE(enum_cast<perfect_hash_case>("oTHER", case_insensitive).value() == perfect_hash_case::Other);
   }
 
   SUBCASE("integer") {
@@ -244,6 +371,72 @@ TEST_CASE("enum_cast") {
 
     REQUIRE(enum_cast<BoolTest>(false).has_value());
     REQUIRE(enum_cast<BoolTest>(0).has_value());
+
+    constexpr auto sw = enum_cast<SparseWide>(-950);
+    REQUIRE(sw.value() == SparseWide::m950);
+    REQUIRE(enum_cast<SparseWide>(1000).value() == SparseWide::p1000);
+    for (int v = -1000; v <= 1000; ++v) {
+      REQUIRE(enum_cast<SparseWide>(static_cast<std::int16_t>(v)).has_value() == (v % 50 == 0));
+    }
+    REQUIRE_FALSE(enum_cast<SparseWide>(static_cast<std::int16_t>(1050)).has_value());
+  }
+}
+
+TEST_CASE("enum_cast_batch") {
+  SUBCASE("string") {
+    const std::array<std::string_view, 4> names = {"red", "GREEN", "None", "BLUE"};
+    std::array<optional<Color>, 4> colors = {};
+    REQUIRE(enum_cast_batch<Color>(names, colors) == 3);
+    REQUIRE(colors[0] == Color::RED);
+    REQUIRE(colors[1] == Color::GREEN);
+    REQUIRE_FALSE(colors[2].has_value());
+    REQUIRE(colors[3] == Color::BLUE);
+
+    const char* directions[] = {"up", "LEFT", "Right"};
+    optional<Directions> results[3] = {};
+    REQUIRE(enum_cast_batch<Directions>(directions, results, case_insensitive) == 3);
+    REQUIRE(results[0] == Directions::Up);
+    REQUIRE(results[1] == Directions::Left);
+    REQUIRE(results[2] == Directions::Right);
+  }
+
+  SUBCASE("integer") {
+    constexpr int values[] = {1, 2, 3, 0, 127, -1};
+    std::array<optional<Numbers>, 6> numbers = {};
+    REQUIRE(enum_cast_batch<Numbers>(values, numbers) == 3);
+    REQUIRE(numbers[0] == Numbers::one);
+    REQUIRE(numbers[1] == Numbers::two);
+    REQUIRE(numbers[2] == Numbers::three);
+    REQUIRE_FALSE(numbers[3].has_value());
+    REQUIRE_FALSE(numbers[4].has_value());
+    REQUIRE_FALSE(numbers[5].has_value());
+
+    const std::int64_t wide[] = {0, 256, 257, -255, 2, 1LL << 40};
+    std::array<optional<SmallDense>, 6> dense = {};
+    REQUIRE(enum_cast_batch<SmallDense>(wide, dense) == 2);
+    REQUIRE(dense[0] == SmallDense::a);
+    REQUIRE_FALSE(dense[1].has_value());
+    REQUIRE_FALSE(dense[2].has_value());
+    REQUIRE_FALSE(dense[3].has_value());
+    REQUIRE(dense[4] == SmallDense::c);
+    REQUIRE_FALSE(dense[5].has_value());
+
+    const std::int64_t wide_sparse[] = {0, 256, 319, -193, 63};
+    std::array<optional<MaxUsedAsInvalid>, 5> sparse = {};
+    REQUIRE(enum_cast_batch<MaxUsedAsInvalid>(wide_sparse, sparse) == 2);
+    REQUIRE(sparse[0] == MaxUsedAsInvalid::ONE);
+    REQUIRE_FALSE(sparse[1].has_value());
+    REQUIRE_FALSE(sparse[2].has_value());
+    REQUIRE_FALSE(sparse[3].has_value());
+    REQUIRE(sparse[4] == MaxUsedAsInvalid::TWO);
+
+    const std::array<int, 4> directions = {85, 0, -120, 120};
+    std::array<optional<Directions>, 4> results = {};
+    REQUIRE(enum_cast_batch<Directions>(directions, results) == 3);
+    REQUIRE(results[0] == Directions::Up);
+    REQUIRE_FALSE(results[1].has_value());
+    REQUIRE(results[2] == Directions::Left);
+    REQUIRE(results[3] == Directions::Right);
   }
 }
 
@@ -322,6 +515,23 @@ TEST_CASE("enum_index") {
   REQUIRE_FALSE(enum_index(static_cast<number>(0)).has_value());
 
   REQUIRE(enum_index<BoolTest::Yay>() == 0);
+
+  constexpr auto sw = enum_index(SparseWide::p1000);
+  REQUIRE(sw.value() == 40);
+  REQUIRE(enum_index<SparseWide::m1000>() == 0);
+  for (std::size_t i = 0; i < enum_count<SparseWide>(); ++i) {
+    REQUIRE(enum_index(enum_value<SparseWide>(i)).value() == i);
+  }
+  REQUIRE_FALSE(enum_index(static_cast<SparseWide>(25)).has_value());
+  REQUIRE_FALSE(enum_index(static_cast<SparseWide>(-999)).has_value());
+
+  REQUIRE(magic_enum::detail::has_index_table_v<Directions, as_common<>>);
+  REQUIRE(magic_enum::detail::has_index_table_v<number, as_common<>>);
+  REQUIRE_FALSE(magic_enum::detail::has_index_table_v<Numbers, as_common<>>);
+  REQUIRE_FALSE(magic_enum::detail::has_index_table_v<SparseWide, as_common<>>);
+  REQUIRE_FALSE(enum_index(static_cast<Directions>(-121)).has_value());
+  REQUIRE_FALSE(enum_index(static_cast<Directions>(121)).has_value());
+  REQUIRE_FALSE(enum_index(static_cast<Directions>(84)).has_value());
 }
 
 TEST_CASE("enum_contains") {
@@ -502,6 +712,10 @@ TEST_CASE("enum_values") {
   constexpr auto& s8 = enum_values<Flaggy>();
   REQUIRE(s8 == std::array<Flaggy, 2>{{Flaggy::Flag0, Flaggy::Flag32}});
 
+  using Nested = TemplateHolder<std::pair<int, char>, 2>::Nested;
+  constexpr auto& s9 = enum_values<Nested>();
+  REQUIRE(s9 == std::array<Nested, 3>{{Nested::A, Nested::B, Nested::C}});
+  REQUIRE(enum_name(Nested::B) == "B");
 }
 
 TEST_CASE("enum_count") {
@@ -524,6 +738,20 @@ TEST_CASE("enum_count") {
   REQUIRE(s6 == 2);
 }
 
+TEST_CASE("enum_values_char_literal_in_type_name") {
+  REQUIRE(enum_count<CharHolder<'('>::Nested>() == 3);
+  REQUIRE(enum_names<CharHolder<'('>::Nested>() == std::array<string_view, 3>{{"a", "b", "c"}});
+  REQUIRE(enum_cast<CharHolder<'('>::Nested>("b") == CharHolder<'('>::Nested::b);
+  REQUIRE(enum_count<CharHolder<'<'>::Nested>() == 3);
+  REQUIRE(enum_count<CharHolder<'['>::Nested>() == 3);
+  REQUIRE(enum_count<CharHolder<'{'>::Nested>() == 3);
+  REQUIRE(enum_count<CharHolder<'}'>::Nested>() == 3);
+  REQUIRE(enum_count<CharHolder<','>::Nested>() == 3);
+  REQUIRE(enum_count<CharHolder<'\''>::Nested>() == 3);
+  REQUIRE(enum_count<CharHolder<'\\'>::Nested>() == 3);
+  REQUIRE(enum_name(CharHolder<'\''>::Nested::c) == "c");
+}
+
 enum lt1 { s1, loooooooooooooooooooong1 };
 enum lt2 : unsigned { s2, loooooooooooooooooooong2 };
 enum class lt3 { s3, loooooooooooooooooooong3 };
@@ -1013,6 +1241,22 @@ TEST_CASE("enum_switch") {
       return enum_integer(val());
     }, static_cast<Color>(0), -1) == -1);
   }
+
+  SUBCASE("wide sparse enum") {
+    constexpr auto p500 = enum_switch<int>([](auto val) {
+      return static_cast<int>(enum_integer(val()));
+    }, SparseWide::p500);
+    REQUIRE(p500 == 500);
+
+    for (const auto v : enum_values<SparseWide>()) {
+      REQUIRE(enum_switch<int>([](auto val) {
+        return static_cast<int>(enum_integer(val()));
+      }, v) == enum_integer(v));
+    }
+    REQUIRE(enum_switch<int>([](auto val) {
+      return static_cast<int>(enum_integer(val()));
+    }, static_cast<SparseWide>(25), -1) == -1);
+  }
 }
 
 TEST_CASE("enum_type_name") {
@@ -1373,6 +1617,65 @@ TEST_CASE("multdimensional-switch-case") {
   REQUIRE(switch_case_3d(Color::BLUE, Directions::Up, Index::two) == 0);
 }
 
+TEST_CASE("enum_fuse_dense") {
+  constexpr auto count = enum_count<Color>() * enum_count<Directions>() * enum_count<Index>();
+  REQUIRE(count == 36);
+
+  constexpr auto first = enum_fuse_dense(Color::RED, Directions::Left, Index::zero);
+  constexpr auto last = enum_fuse_dense(Color::BLUE, Directions::Right, Index::two);
+  REQUIRE(first == 0);
+  REQUIRE(last == count - 1);
+  REQUIRE(enum_fuse_dense(Color::RED, Directions::Left, Index::one) == 1);
+  REQUIRE(enum_fuse_dense(Color::RED, Directions::Down, Index::zero) == 3);
+  REQUIRE(enum_fuse_dense(Color::GREEN, Directions::Left, Index::zero) == 12);
+
+  std::array<int, count> seen = {};
+  for (const auto c : enum_values<Color>()) {
+    for (const auto d : enum_values<Directions>()) {
+      for (const auto i : enum_values<Index>()) {
+        const auto key = enum_fuse_dense(c, d, i);
+        REQUIRE(key.has_value());
+        ++seen[*key];
+        REQUIRE(enum_unfuse<Color, Directions, Index>(*key) == std::tuple{c, d, i});
+      }
+    }
+  }
+  for (const auto s : seen) {
+    REQUIRE(s == 1);
+  }
+
+  constexpr auto unfused = enum_unfuse<Color, Directions>(11);
+  REQUIRE(unfused == std::tuple{Color::BLUE, Directions::Right});
+  REQUIRE_FALSE(enum_unfuse<Color, Directions>(12).has_value());
+}
+
+TEST_CASE("multidimensional enum_switch") {
+  const auto switcher = overloaded{
+      [](enum_constant<Color::RED>, enum_constant<Directions::Up>) { return 1; },
+      [](enum_constant<Color::BLUE>, enum_constant<Directions::Down>) { return 2; },
+      [](auto, auto) { return 0; }};
+  REQUIRE(enum_switch(switcher, Color::RED, Directions::Up) == 1);
+  REQUIRE(enum_switch(switcher, Color::RED, Directions::Down) == 0);
+  REQUIRE(enum_switch(switcher, Color::BLUE, Directions::Down) == 2);
+  REQUIRE(enum_switch(switcher, static_cast<Color>(0), Directions::Down) == 0);
+
+  constexpr auto sum = [](auto c, auto d, auto i) { return enum_integer(c()) * 1000 + enum_integer(d()) * 10 + enum_integer(i()); };
+  constexpr auto cli = enum_switch(sum, Color::BLUE, Directions::Left, Index::two);
+  REQUIRE(cli == 15000 - 1200 + 2);
+  for (const auto c : enum_values<Color>()) {
+    for (const auto d : enum_values<Directions>()) {
+      for (const auto i : enum_values<Index>()) {
+        REQUIRE(enum_switch(sum, c, d, i) == enum_integer(c) * 1000 + enum_integer(d) * 10 + enum_integer(i));
+      }
+    }
+  }
+  REQUIRE(enum_switch<int>(sum, Color::RED, Directions::Up, static_cast<Index>(7)) == 0);
+
+  const auto partial = [](enum_constant<Color::GREEN>, enum_constant<Index::one>) { return 'g'; };
+  REQUIRE(enum_switch<char>(partial, Color::GREEN, Index::one) == 'g');
+  REQUIRE(enum_switch<char>(partial, Color::GREEN, Index::two) == char{});
+}
+
 #endif
 
 #if __has_include(<fmt/format.h>)
@@ -1388,6 +1691,10 @@ TEST_CASE("multdimensional-switch-case") {
 TEST_CASE("format-base") {
   REQUIRE(std::format("{}", Color::RED) == "red");
   REQUIRE(std::format("{}", Color{0}) == "0");
+  REQUIRE(std::format("{}", static_cast<Color>(-3)) == "-3");
+  REQUIRE(std::format("{:*<6}", Color::RED) == "red***");
+  REQUIRE(std::format("{:>3}", Color{0}) == "  0");
+  REQUIRE(std::format("{:.2}", Color::GREEN) == "GR");
 }
 
 #endif
@@ -1397,6 +1704,24 @@ TEST_CASE("format-base") {
 TEST_CASE("format-fmt") {
   REQUIRE(fmt::format("{}", Color::GREEN) == "GREEN");
   REQUIRE(fmt::format("{}", Color{0}) == "0");
+  REQUIRE(fmt::format("{}", static_cast<Color>(-3)) == "-3");
+  REQUIRE(fmt::format("{:*<6}", Color::RED) == "red***");
+  REQUIRE(fmt::format("{:>3}", Color{0}) == "  0");
+  REQUIRE(fmt::format("{:n}", Color::GREEN) == "GREEN");
+  REQUIRE(fmt::format("{:d}", Color::RED) == "-12");
+  REQUIRE(fmt::format("{:x}", Color::BLUE) == "f");
+  REQUIRE(fmt::format("{:x}", Color::RED) == "fffffff4");
+  REQUIRE(fmt::format("{:*^5d}", Color::GREEN) == "**7**");
+  REQUIRE(fmt::format("{:t}", Color::GREEN) == "Color::GREEN");
+  REQUIRE(fmt::format("{:>14t}", Color::GREEN) == "  Color::GREEN");
+  REQUIRE(fmt::format("{:t}", Color{0}) == "0");
+  REQUIRE(fmt::format("{:f,}", Color::RED) == "red");
+  REQUIRE(fmt::format("{:.<5d}", Color::GREEN) == "7....");
+  REQUIRE(fmt::format("{:.2}", Color::GREEN) == "GR");
+  REQUIRE(fmt::format("{:*>5f,}", Color::RED) == "**red");
+  REQUIRE(fmt::format("{:<f<}", Color::RED) == "red");
+  REQUIRE_THROWS_AS(static_cast<void>(fmt::format(fmt::runtime("{:.2d}"), Color::RED)), fmt::format_error);
+  REQUIRE_THROWS_AS(static_cast<void>(fmt::format(fmt::runtime("{:.1x}"), Color::RED)), fmt::format_error);
 }
 
 #endif
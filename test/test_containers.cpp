@@ -12,7 +12,7 @@
 #include <magic_enum/magic_enum_containers.hpp>
 #undef max
 
-#if defined(MAGIC_ENUM_THROW) || defined(MAGIC_ENUM_CONTAINERS_THROW)
+#if defined(MAGIC_ENUM_THROW) || defined(MAGIC_ENUM_CONTAINERS_THROW) || defined(MAGIC_ENUM_CONTAINERS_EXCEPTIONS) || defined(MAGIC_ENUM_CONTAINERS_SIMD_SSE2) || defined(MAGIC_ENUM_SIMD_SSE2)
 #  error Internal containers macro leaked from magic_enum_containers.hpp.
 #endif
 
@@ -21,9 +21,12 @@
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 enum class Color { RED = 1, GREEN = 2, BLUE = 4 };
 template <>
@@ -305,6 +308,91 @@ TEST_CASE("containers_array") {
   REQUIRE_THROWS(custom_index_array.at(static_cast<Color>(8)));
 }
 
+TEST_CASE("containers_array_padded") {
+  using Padded = magic_enum::containers::array<Color, int, magic_enum::containers::default_indexing<Color>, magic_enum::containers::padded<>>;
+  REQUIRE(alignof(Padded) >= MAGIC_ENUM_CACHE_LINE_SIZE);
+  REQUIRE(sizeof(Padded) == magic_enum::enum_count<Color>() * MAGIC_ENUM_CACHE_LINE_SIZE);
+  REQUIRE(sizeof(magic_enum::containers::array<Color, RGB, magic_enum::containers::default_indexing<Color>, magic_enum::containers::padded<2>>) == 3 * 4);
+
+  Padded counters{};
+  REQUIRE(counters.size() == 3);
+  REQUIRE(std::distance(counters.begin(), counters.end()) == 3);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(&counters[Color::GREEN]) - reinterpret_cast<std::uintptr_t>(&counters[Color::RED]) == MAGIC_ENUM_CACHE_LINE_SIZE);
+
+  counters[Color::RED] = 3;
+  counters.at(Color::GREEN) = 1;
+  magic_enum::containers::get<Color::BLUE>(counters) = 2;
+  REQUIRE_THROWS(counters.at(static_cast<Color>(0)));
+  REQUIRE(magic_enum::containers::get<0>(counters) == 3);
+  REQUIRE(counters.front() == 3);
+  REQUIRE(counters.back() == 2);
+  REQUIRE(std::vector<int>(counters.begin(), counters.end()) == std::vector<int>{3, 1, 2});
+  REQUIRE(std::vector<int>(counters.crbegin(), counters.crend()) == std::vector<int>{2, 1, 3});
+  REQUIRE(check_const(counters.cbegin()));
+
+  std::sort(counters.begin(), counters.end());
+  REQUIRE(std::vector<int>(counters.begin(), counters.end()) == std::vector<int>{1, 2, 3});
+
+  Padded other{};
+  other.fill(7);
+  REQUIRE(other != counters);
+  REQUIRE(counters < other);
+  other.swap(counters);
+  REQUIRE(counters[Color::BLUE] == 7);
+  REQUIRE(other[Color::BLUE] == 3);
+
+  constexpr auto constexpr_padded = [] {
+    magic_enum::containers::array<Color, int, magic_enum::containers::default_indexing<Color>, magic_enum::containers::padded<16>> a{};
+    a[Color::GREEN] = 5;
+    return a;
+  }();
+  static_assert(constexpr_padded[Color::GREEN] == 5);
+}
+
+TEST_CASE("containers_matrix") {
+  using namespace magic_enum::bitwise_operators;
+
+  using Matrix = magic_enum::containers::matrix<int, Color, Numbers, Nibble>;
+  static_assert(std::tuple_size_v<Matrix::container_type> == 3 * 4 * 8);
+  static_assert(sizeof(Matrix) == sizeof(int) * 3 * 4 * 8);
+
+  REQUIRE(Matrix::index(Color::RED, Numbers::ONE, Nibble::B0) == 0);
+  REQUIRE(Matrix::index(Color::RED, Numbers::ONE, Nibble::B1) == 1);
+  REQUIRE(Matrix::index(Color::RED, Numbers::TWO, Nibble::B0) == 8);
+  REQUIRE(Matrix::index(Color::GREEN, Numbers::ONE, Nibble::B0) == 32);
+  REQUIRE(Matrix::index(Color::BLUE, Numbers::FOUR, Nibble::B7) == 95);
+  REQUIRE_FALSE(Matrix::index(Color::RED | Color::GREEN, Numbers::ONE, Nibble::B0).has_value());
+
+  Matrix m{};
+  REQUIRE(m.size() == 96);
+  REQUIRE_FALSE(m.empty());
+  REQUIRE(std::all_of(m.begin(), m.end(), [](int v) { return v == 0; }));
+
+  m(Color::GREEN, Numbers::THREE, Nibble::B5) = 42;
+  ++m.at(Color::BLUE, Numbers::FOUR, Nibble::B7);
+  REQUIRE(m.at(Color::GREEN, Numbers::THREE, Nibble::B5) == 42);
+  REQUIRE(m.data()[*Matrix::index(Color::GREEN, Numbers::THREE, Nibble::B5)] == 42);
+  REQUIRE(m.back() == 1);
+  REQUIRE_THROWS(m.at(Color::RED | Color::GREEN, Numbers::ONE, Nibble::B0));
+
+  Matrix other{};
+  REQUIRE(other != m);
+  REQUIRE(other < m);
+  other.swap(m);
+  REQUIRE(other(Color::GREEN, Numbers::THREE, Nibble::B5) == 42);
+  REQUIRE(m(Color::GREEN, Numbers::THREE, Nibble::B5) == 0);
+  m.fill(7);
+  REQUIRE(m.front() == 7);
+
+  constexpr auto cm = [] {
+    magic_enum::containers::matrix<char, Numbers, Color> r{};
+    r(Numbers::TWO, Color::BLUE) = 'x';
+    return r;
+  }();
+  static_assert(cm(Numbers::TWO, Color::BLUE) == 'x');
+  static_assert(cm.a[5] == 'x');
+}
+
 TEST_CASE("containers_bitset") {
 
   using namespace magic_enum::bitwise_operators;
@@ -498,6 +586,110 @@ TEST_CASE("containers_bitset_all_full_storage") {
   }());
 }
 
+TEST_CASE("containers_bitset_wide_bulk") {
+  magic_enum::containers::bitset<Bits65> lhs;
+  magic_enum::containers::bitset<Bits65> rhs;
+  for (auto value : {Bits65::B00, Bits65::B17, Bits65::B63, Bits65::B64}) {
+    lhs.set(value);
+  }
+  for (auto value : {Bits65::B17, Bits65::B40, Bits65::B64}) {
+    rhs.set(value);
+  }
+  REQUIRE(lhs.count() == 4);
+  REQUIRE(lhs.and_count(rhs) == 2);
+  REQUIRE(lhs.and_count(rhs) == (lhs & rhs).count());
+  REQUIRE(lhs.intersects(rhs));
+  REQUIRE((lhs | rhs).count() == 5);
+  REQUIRE((lhs ^ rhs).count() == 3);
+  REQUIRE((~lhs).count() == 61);
+  REQUIRE_FALSE((~lhs).test(Bits65::B64));
+
+  rhs &= ~lhs;
+  REQUIRE(rhs.count() == 1);
+  REQUIRE_FALSE(lhs.intersects(rhs));
+  REQUIRE(lhs.and_count(rhs) == 0);
+  REQUIRE((lhs | ~lhs).all());
+  REQUIRE_FALSE((lhs | rhs).all());
+
+  static_assert([] {
+    magic_enum::containers::bitset<Bits65> a;
+    magic_enum::containers::bitset<Bits65> b;
+    a.set(Bits65::B01).set(Bits65::B64);
+    b.set(Bits65::B64);
+    return a.and_count(b) == 1 && a.intersects(b) && !a.intersects(~a) && (a ^ b).count() == 1;
+  }());
+}
+
+TEST_CASE("containers_atomic_bitset") {
+  magic_enum::containers::atomic_bitset<Bits65> bits;
+  REQUIRE(bits.size() == 65);
+  REQUIRE(bits.snapshot().none());
+  REQUIRE_FALSE(bits.test_and_set(Bits65::B64));
+  REQUIRE(bits.test_and_set(Bits65::B64, std::memory_order_acq_rel));
+  bits.set(Bits65::B03, std::memory_order_release);
+  REQUIRE(bits.test(Bits65::B03, std::memory_order_acquire));
+  REQUIRE_FALSE(bits.test(Bits65::B04));
+
+  auto snapshot = bits.snapshot();
+  REQUIRE(snapshot.count() == 2);
+  REQUIRE(snapshot.test(Bits65::B64));
+
+  REQUIRE(bits.test_and_reset(Bits65::B03));
+  REQUIRE_FALSE(bits.test_and_reset(Bits65::B03));
+  bits.reset(Bits65::B64);
+  REQUIRE(bits.snapshot().none());
+
+  bits.store(snapshot);
+  REQUIRE(bits.snapshot() == snapshot);
+  bits.reset();
+  REQUIRE(bits.snapshot().none());
+
+  const magic_enum::containers::atomic_bitset<Color> colors {magic_enum::containers::bitset<Color>{Color::RED, Color::BLUE}};
+  REQUIRE(colors.test(Color::BLUE));
+  REQUIRE_FALSE(colors.test(Color::GREEN));
+  REQUIRE_THROWS_AS(static_cast<void>(colors.test(static_cast<Color>(8))), std::out_of_range);
+
+  magic_enum::containers::atomic_bitset<Color, OutOfRangeIndex> custom_index_bits;
+  REQUIRE_THROWS(custom_index_bits.set(static_cast<Color>(8)));
+  REQUIRE_THROWS(custom_index_bits.reset(static_cast<Color>(8)));
+}
+
+TEST_CASE("containers_atomic_bitset_concurrent") {
+  constexpr std::size_t thread_count = 4;
+  constexpr int rounds = 1000;
+  magic_enum::containers::atomic_bitset<Bits65> bits;
+  std::atomic<int> wins {0};
+  std::atomic<int> lost_resets {0};
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&bits, &wins, &lost_resets, t] {
+      // Distinct bits share words with bits of other threads.
+      for (std::size_t i = t; i < 64; i += thread_count) {
+        bits.set(magic_enum::enum_value<Bits65>(i));
+      }
+      // Shared bit: set and reset must be won by exactly one thread at a time.
+      for (int r = 0; r < rounds; ++r) {
+        if (!bits.test_and_set(Bits65::B64, std::memory_order_acq_rel)) {
+          wins.fetch_add(1);
+          if (!bits.test_and_reset(Bits65::B64, std::memory_order_acq_rel)) {
+            lost_resets.fetch_add(1);
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  REQUIRE(wins.load() > 0);
+  REQUIRE(lost_resets.load() == 0);
+  const auto snapshot = bits.snapshot();
+  REQUIRE(snapshot.count() == 64);
+  REQUIRE_FALSE(snapshot.test(Bits65::B64));
+}
+
 TEST_CASE("containers_set") {
 
   using namespace magic_enum::bitwise_operators;
@@ -644,6 +836,219 @@ TEST_CASE("containers_set") {
   REQUIRE(equivalent_name_set.insert(EquivalentNames::A).second);
   REQUIRE(equivalent_name_set.erase("a") == 2);
   REQUIRE(equivalent_name_set.empty());
+
+  magic_enum::containers::set<Bits65> wide_set {Bits65::B03, Bits65::B63, Bits65::B64};
+  REQUIRE(std::vector<Bits65>(wide_set.begin(), wide_set.end()) == std::vector<Bits65>{Bits65::B03, Bits65::B63, Bits65::B64});
+  REQUIRE(std::vector<Bits65>(wide_set.rbegin(), wide_set.rend()) == std::vector<Bits65>{Bits65::B64, Bits65::B63, Bits65::B03});
+  REQUIRE(*wide_set.lower_bound(Bits65::B03) == Bits65::B03);
+  REQUIRE(*wide_set.lower_bound(Bits65::B04) == Bits65::B63);
+  REQUIRE(*wide_set.upper_bound(Bits65::B63) == Bits65::B64);
+  REQUIRE(wide_set.upper_bound(Bits65::B64) == wide_set.end());
+  REQUIRE(*std::prev(wide_set.lower_bound(Bits65::B63)) == Bits65::B03);
+  REQUIRE(*wide_set.erase(wide_set.find(Bits65::B03)) == Bits65::B63);
+
+  const magic_enum::containers::set<Bits65> lhs_set {Bits65::B01, Bits65::B40, Bits65::B64};
+  const magic_enum::containers::set<Bits65> rhs_set {Bits65::B40, Bits65::B63};
+  REQUIRE((lhs_set | rhs_set) == magic_enum::containers::set<Bits65>{Bits65::B01, Bits65::B40, Bits65::B63, Bits65::B64});
+  REQUIRE((lhs_set | rhs_set).size() == 4);
+  REQUIRE((lhs_set & rhs_set) == magic_enum::containers::set<Bits65>{Bits65::B40});
+  REQUIRE((lhs_set & rhs_set).size() == 1);
+  REQUIRE((lhs_set - rhs_set) == magic_enum::containers::set<Bits65>{Bits65::B01, Bits65::B64});
+  REQUIRE((lhs_set - rhs_set).size() == 2);
+  REQUIRE((lhs_set ^ rhs_set).size() == 3);
+  REQUIRE(lhs_set.includes(lhs_set & rhs_set));
+  REQUIRE(lhs_set.includes({}));
+  REQUIRE_FALSE(lhs_set.includes(rhs_set));
+  auto algebra_set = lhs_set;
+  algebra_set -= lhs_set;
+  REQUIRE(algebra_set.empty());
+  algebra_set |= rhs_set;
+  algebra_set &= lhs_set;
+  REQUIRE(algebra_set.size() == 1);
+  REQUIRE(*algebra_set.begin() == Bits65::B40);
+
+  constexpr magic_enum::containers::set<Bits65, std::greater<>> reversed_set {Bits65::B01, Bits65::B40};
+  static_assert((reversed_set - reversed_set).empty());
+  static_assert(*reversed_set.begin() == Bits65::B40);
+  static_assert(*reversed_set.lower_bound(Bits65::B39) == Bits65::B01);
+  static_assert(reversed_set.upper_bound(Bits65::B01) == reversed_set.end());
+}
+
+struct ThrowOnCopy {
+  static inline int live = 0;
+  static inline int copies_left = 0;
+  ThrowOnCopy() { ++live; }
+  ThrowOnCopy(const ThrowOnCopy&) {
+    if (copies_left-- == 0) {
+      throw std::runtime_error("copy");
+    }
+    ++live;
+  }
+  ThrowOnCopy& operator=(const ThrowOnCopy&) = default;
+  ~ThrowOnCopy() { --live; }
+};
+
+TEST_CASE("containers_map") {
+  magic_enum::containers::map<Nibble, std::string> m;
+  REQUIRE(m.empty());
+  REQUIRE(m.max_size() == 8);
+  REQUIRE(m.begin() == m.end());
+
+  REQUIRE(m.try_emplace(Nibble::B5, 3, 'x').second);
+  REQUIRE_FALSE(m.try_emplace(Nibble::B5, "ignored").second);
+  REQUIRE(m.insert({Nibble::B1, "one"}).second);
+  REQUIRE_FALSE(m.insert_or_assign(Nibble::B1, "uno").second);
+  m[Nibble::B7] = "seven";
+  REQUIRE(m.size() == 3);
+  REQUIRE(m.at(Nibble::B5) == "xxx");
+  REQUIRE(m[Nibble::B1] == "uno");
+  REQUIRE_THROWS_AS(static_cast<void>(m.at(Nibble::B0)), std::out_of_range);
+  REQUIRE(m.contains(Nibble::B7));
+  REQUIRE(m.count(Nibble::B2) == 0);
+  REQUIRE(m.find(Nibble::B2) == m.end());
+  REQUIRE(m.find(Nibble::B5)->second == "xxx");
+
+  std::vector<Nibble> keys;
+  for (auto [key, value] : m) {
+    keys.push_back(key);
+    value += "!";
+  }
+  REQUIRE(keys == std::vector<Nibble>{Nibble::B1, Nibble::B5, Nibble::B7});
+  REQUIRE(m[Nibble::B7] == "seven!");
+  REQUIRE((*std::prev(m.cend())).first == Nibble::B7);
+
+  auto copy = m;
+  REQUIRE(copy == m);
+  REQUIRE(m.erase(Nibble::B5) == 1);
+  REQUIRE(m.erase(Nibble::B5) == 0);
+  REQUIRE(copy != m);
+  REQUIRE(m.erase(m.find(Nibble::B1))->first == Nibble::B7);
+  REQUIRE(m.size() == 1);
+
+  m = std::move(copy);
+  REQUIRE(m.size() == 3);
+  decltype(m) other;
+  m.swap(other);
+  REQUIRE(m.empty());
+  REQUIRE(other.size() == 3);
+  REQUIRE(other[Nibble::B5] == "xxx!");
+  decltype(m) overlapping {{Nibble::B5, "five"}, {Nibble::B2, "two"}};
+  other.swap(overlapping);
+  REQUIRE(other.size() == 2);
+  REQUIRE(other.at(Nibble::B5) == "five");
+  REQUIRE(other.at(Nibble::B2) == "two");
+  REQUIRE(overlapping.size() == 3);
+  REQUIRE(overlapping.at(Nibble::B5) == "xxx!");
+  REQUIRE_FALSE(overlapping.contains(Nibble::B2));
+  other.swap(overlapping);
+  REQUIRE(other.size() == 3);
+  other.clear();
+  REQUIRE(other.empty());
+  REQUIRE(other.begin() == other.end());
+
+  struct NoDefault {
+    explicit NoDefault(int v) : value(v) {}
+    int value;
+  };
+  magic_enum::containers::map<Numbers, NoDefault> no_default {{Numbers::THREE, NoDefault{3}}};
+  no_default.try_emplace(Numbers::ONE, 1);
+  REQUIRE(no_default.begin()->second.value == 1);
+  REQUIRE(no_default.at(Numbers::THREE).value == 3);
+
+  {
+    magic_enum::containers::map<Numbers, ThrowOnCopy> throwing;
+    throwing.try_emplace(Numbers::ONE);
+    throwing.try_emplace(Numbers::TWO);
+    throwing.try_emplace(Numbers::FOUR);
+    ThrowOnCopy::copies_left = 2;
+    REQUIRE_THROWS_AS(static_cast<void>(decltype(throwing){throwing}), std::runtime_error);
+    REQUIRE(ThrowOnCopy::live == 3);
+    magic_enum::containers::map<Numbers, ThrowOnCopy> target;
+    target.try_emplace(Numbers::THREE);
+    ThrowOnCopy::copies_left = 1;
+    REQUIRE_THROWS_AS(target = throwing, std::runtime_error);
+    REQUIRE(ThrowOnCopy::live == 3);
+    REQUIRE(target.empty());
+    REQUIRE(target.begin() == target.end());
+  }
+  REQUIRE(ThrowOnCopy::live == 0);
+
+  magic_enum::containers::map<Color, int, OutOfRangeIndex> custom_index_map;
+  REQUIRE(custom_index_map.try_emplace(static_cast<Color>(8), 1).first == custom_index_map.end());
+  REQUIRE(custom_index_map.find(static_cast<Color>(8)) == custom_index_map.end());
+  REQUIRE(custom_index_map.erase(static_cast<Color>(8)) == 0);
+
+  constexpr auto flat = [] {
+    magic_enum::containers::flat_map<Numbers, int> r{{Numbers::FOUR, 4}, {Numbers::TWO, 2}};
+    r[Numbers::ONE] = 1;
+    r.erase(Numbers::TWO);
+    return r;
+  }();
+  static_assert(flat.size() == 2);
+  static_assert(flat.at(Numbers::FOUR) == 4);
+  static_assert(!flat.contains(Numbers::TWO));
+  static_assert(std::is_trivially_copyable_v<decltype(flat)>);
+  int sum = 0;
+  for (auto [key, value] : flat) {
+    sum += magic_enum::enum_integer(key) * value;
+  }
+  REQUIRE(sum == 12);
+}
+
+TEST_CASE("containers_counter_array") {
+  static magic_enum::containers::counter_array<Numbers, 4> counters;
+  REQUIRE(counters.size() == 4);
+  REQUIRE(alignof(decltype(counters)) >= MAGIC_ENUM_CACHE_LINE_SIZE);
+  REQUIRE(sizeof(counters) == 4 * MAGIC_ENUM_CACHE_LINE_SIZE);
+
+  counters.add(Numbers::TWO);
+  counters.add(Numbers::TWO, 5);
+  counters.add(Numbers::FOUR);
+  counters.add(static_cast<Numbers>(42));
+  REQUIRE(counters.get(Numbers::TWO) == 6);
+  REQUIRE(counters.get(Numbers::ONE) == 0);
+  REQUIRE(counters.get(static_cast<Numbers>(42)) == 0);
+
+  const auto totals = counters.collect();
+  REQUIRE(totals[Numbers::TWO] == 6);
+  REQUIRE(totals[Numbers::FOUR] == 1);
+  REQUIRE(totals[Numbers::THREE] == 0);
+
+  counters.reset();
+  REQUIRE(counters.collect() == magic_enum::containers::array<Numbers, std::uint64_t>{});
+}
+
+TEST_CASE("containers_counter_array_concurrent") {
+  // More threads than shards, so some threads share shard.
+  constexpr std::size_t thread_count = 6;
+  constexpr std::uint64_t adds = 10000;
+  static magic_enum::containers::counter_array<Numbers, 4> counters;
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([] {
+      for (std::uint64_t i = 0; i < adds; ++i) {
+        counters.add(Numbers::ONE);
+        counters.add(Numbers::THREE, 2);
+      }
+    });
+  }
+  // Concurrent reads see counters that never decrease.
+  std::uint64_t last = 0;
+  for (int i = 0; i < 100; ++i) {
+    const auto current = counters.get(Numbers::ONE);
+    REQUIRE(current >= last);
+    REQUIRE(current <= thread_count * adds);
+    last = current;
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto totals = counters.collect();
+  REQUIRE(totals[Numbers::ONE] == thread_count * adds);
+  REQUIRE(totals[Numbers::TWO] == 0);
+  REQUIRE(totals[Numbers::THREE] == 2 * thread_count * adds);
 }
 
 TEST_CASE("map_like_container") {
@@ -17,8 +17,11 @@
 
 #include <array>
 #include <cctype>
+#include <chrono>
+#include <iterator>
 #include <string>
 #include <string_view>
+#include <thread>
 
 enum class Color { RED = 1, GREEN = 2, BLUE = 4 };
 template <>
@@ -510,6 +513,8 @@ TEST_CASE("enum_name") {
 }
 
 TEST_CASE("enum_flags_name") {
+  // Default configuration formats flag names by bit scan, names pool of flag combinations is tested in test_flags_name_cache.cpp.
+  static_assert(!magic_enum::detail::has_flags_name_cache_v<Color, as_flags<>>);
   constexpr Color cr = Color::RED;
   auto cr_name = enum_flags_name(cr);
   Color cm[3] = {Color::RED, Color::GREEN, Color::BLUE};
@@ -530,6 +535,7 @@ TEST_CASE("enum_flags_name") {
   REQUIRE(enum_flags_name(Numbers::many) == "many");
   REQUIRE(enum_flags_name(Numbers::many | Numbers::two) == "two|many");
   REQUIRE(enum_flags_name(static_cast<Numbers>(0)).empty());
+  REQUIRE(enum_flags_name(static_cast<Numbers>(std::numeric_limits<int>::min())).empty());
 
   constexpr Directions dr = Directions::Right;
   auto dr_name = enum_flags_name(dr);
@@ -539,6 +545,7 @@ TEST_CASE("enum_flags_name") {
   REQUIRE(dr_name == "Right");
   REQUIRE(enum_flags_name(Directions::Left) == "Left");
   REQUIRE(enum_flags_name(Directions::Right | Directions::Up | Directions::Left | Directions::Down) == "Left|Down|Up|Right");
+  REQUIRE(enum_flags_name(Directions::Right | static_cast<Directions>(std::uint64_t{1} << 62)).empty());
   REQUIRE(enum_flags_name(static_cast<Directions>(0)).empty());
 
   constexpr number nto = number::three | number::one;
@@ -560,6 +567,45 @@ TEST_CASE("enum_flags_name") {
   REQUIRE(enum_flags_name(CStyleFlags_A | CStyleFlags_B | CStyleFlags_C, ',') == "A,B,C");
 }
 
+TEST_CASE("enum_flags_name_to") {
+  static_assert(enum_flags_name_max_size<Color>() == sizeof("RED|GREEN|BLUE") - 1);
+  static_assert(enum_flags_name_max_size<Directions>() == sizeof("Left|Down|Up|Right") - 1);
+
+  SUBCASE("buffer") {
+    char buffer[enum_flags_name_max_size<Color>()] = {};
+    REQUIRE(enum_flags_name_to(buffer, Color::RED | Color::BLUE) == 8);
+    REQUIRE(std::string_view{buffer, 8} == "RED|BLUE");
+    REQUIRE(enum_flags_name_to(buffer, Color::RED | Color::GREEN | Color::BLUE, ',') == sizeof(buffer));
+    REQUIRE(std::string_view{buffer, sizeof(buffer)} == "RED,GREEN,BLUE");
+    REQUIRE(enum_flags_name_to(buffer, Color::RED | Color{8}) == 0);
+    REQUIRE(enum_flags_name_to(buffer, static_cast<Color>(0)) == 0);
+
+    std::array<char, 4> small = {};
+    REQUIRE(enum_flags_name_to(small, Color::GREEN) == 0);
+    REQUIRE(enum_flags_name_to(small, Color::RED) == 3);
+    REQUIRE(enum_flags_name_to(small.data(), 2, Color::RED) == 0);
+
+    constexpr auto name = [] {
+      std::array<char, enum_flags_name_max_size<Numbers>()> b = {};
+      const auto n = enum_flags_name_to(b, Numbers::many | Numbers::two);
+      return std::pair{b, n};
+    }();
+    static_assert(std::string_view{name.first.data(), name.second} == "two|many");
+  }
+
+  SUBCASE("output iterator") {
+    std::string name;
+    enum_flags_name_to(std::back_inserter(name), Directions::Right | Directions::Left);
+    REQUIRE(name == "Left|Right");
+    enum_flags_name_to(std::back_inserter(name), static_cast<Directions>(0));
+    REQUIRE(name == "Left|Right");
+
+    std::string buffer(8, '\0');
+    const auto end = enum_flags_name_to(buffer.begin(), CStyleFlags_A | CStyleFlags_D, ',');
+    REQUIRE(std::string_view{buffer.data(), static_cast<std::size_t>(end - buffer.begin())} == "A,D");
+  }
+}
+
 TEST_CASE("enum_names") {
   REQUIRE(std::is_same_v<decltype(enum_names<Color>()), const std::array<std::string_view, 3>&>);
 
@@ -864,6 +910,8 @@ TEST_CASE("constexpr_for") {
 
 TEST_CASE("format-base") {
   REQUIRE(std::format("Test-{:~^11}.", Color::RED | Color::GREEN) == "Test-~RED|GREEN~.");
+  REQUIRE(std::format("{}", Directions::Left | Directions::Up) == "Left|Up");
+  REQUIRE(std::format("{:>3}", static_cast<Color>(8)) == "  8");
 }
 
 #endif
@@ -872,6 +920,20 @@ TEST_CASE("format-base") {
 
 TEST_CASE("format-fmt") {
   REQUIRE(fmt::format("{}", Color::RED | Color::GREEN) == "RED|GREEN");
+  REQUIRE(fmt::format("{}", Directions::Left | Directions::Up) == "Left|Up");
+  REQUIRE(fmt::format("{}", static_cast<Color>(8)) == "8");
+  REQUIRE(fmt::format("Test-{:~^11}.", Color::RED | Color::GREEN) == "Test-~RED|GREEN~.");
+  REQUIRE(fmt::format("{:>3}", static_cast<Color>(8)) == "  8");
+  REQUIRE(fmt::format("{:f,}", Color::RED | Color::GREEN) == "RED,GREEN");
+  REQUIRE(fmt::format("{:f}", Color::RED | Color::BLUE) == "RED|BLUE");
+  REQUIRE(fmt::format("{:t}", Color::RED | Color::GREEN) == "Color::RED|Color::GREEN");
+  REQUIRE(fmt::format("{:x}", Color::RED | Color::BLUE) == "5");
+  REQUIRE(fmt::format("{:d}", Color::RED | Color::BLUE) == "5");
+  REQUIRE(fmt::format("{:<12f+}", Directions::Left | Directions::Up) == "Left+Up     ");
+  REQUIRE(fmt::format("{:f,}", static_cast<Color>(8)) == "8");
+  REQUIRE(fmt::format("{:f<}", Color::RED | Color::GREEN) == "RED|GREEN");
+  REQUIRE(fmt::format("{:<f<}", Color::RED | Color::GREEN) == "RED<GREEN");
+  REQUIRE(fmt::format("{}", static_cast<Color>(0)) == "0");
 }
 
 #endif
@@ -919,6 +981,70 @@ TEST_CASE("enum_flags_test_any") {
   REQUIRE(enum_flags_test(Numbers::none, Numbers::one) == enum_flags_test_any(Numbers::none, Numbers::one));
 }
 
+TEST_CASE("atomic_flags") {
+  using namespace magic_enum::bitwise_operators;
+
+  atomic_flags<Color> flags;
+  REQUIRE(flags.load() == static_cast<Color>(0));
+  REQUIRE(flags.fetch_set(Color::RED | Color::BLUE, std::memory_order_acq_rel) == static_cast<Color>(0));
+  REQUIRE(flags.test_any(Color::RED | Color::GREEN));
+  REQUIRE_FALSE(flags.test_any(Color::GREEN));
+  REQUIRE(flags.test_all(Color::RED | Color::BLUE, std::memory_order_acquire));
+  REQUIRE_FALSE(flags.test_all(Color::RED | Color::GREEN));
+  REQUIRE_FALSE(flags.test_all(static_cast<Color>(0)));
+  REQUIRE_FALSE(flags.test_any(static_cast<Color>(0)));
+
+  REQUIRE(flags.fetch_clear(Color::RED) == (Color::RED | Color::BLUE));
+  REQUIRE(flags.load() == Color::BLUE);
+  REQUIRE(flags.exchange(Color::GREEN) == Color::BLUE);
+  flags.store(Color::RED | Color::GREEN, std::memory_order_release);
+  REQUIRE(enum_flags_name(flags.load()) == "RED|GREEN");
+
+  const atomic_flags<Numbers> numbers {Numbers::one | Numbers::many};
+  REQUIRE(numbers.test_all(Numbers::many));
+  REQUIRE_FALSE(numbers.test_any(Numbers::two));
+
+#if defined(__cpp_lib_atomic_wait) && __cpp_lib_atomic_wait >= 201907L
+  REQUIRE(flags.wait_for_any(Color::GREEN | Color::BLUE) == (Color::RED | Color::GREEN));
+  flags.notify_all();
+#endif
+}
+
+#if defined(__cpp_lib_atomic_wait) && __cpp_lib_atomic_wait >= 201907L
+TEST_CASE("atomic_flags_wait_for_any_blocking") {
+  using namespace magic_enum::bitwise_operators;
+
+  for (int i = 0; i < 8; ++i) {
+    atomic_flags<Color> flags {Color::RED};
+    std::atomic<bool> waiting {false};
+    Color woken = static_cast<Color>(0);
+
+    std::thread waiter([&] {
+      waiting.store(true);
+      woken = flags.wait_for_any(Color::GREEN | Color::BLUE);
+    });
+
+    while (!waiting.load()) {
+      std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    // Unrelated flag and spurious notify must not release the waiter.
+    flags.fetch_clear(Color::RED);
+    flags.notify_all();
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    flags.fetch_set(Color::BLUE);
+    if (i % 2 == 0) {
+      flags.notify_one();
+    } else {
+      flags.notify_all();
+    }
+    waiter.join();
+
+    REQUIRE(woken == Color::BLUE);
+  }
+}
+#endif
+
 TEST_CASE("enum_next_value") {
   REQUIRE(enum_next_value(Color::RED) == Color::GREEN);
   REQUIRE(enum_next_value(Color::RED, 2) == Color::BLUE);
@@ -0,0 +1,78 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 - 2026 Daniil Goncharov <neargye@gmail.com>.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#define MAGIC_ENUM_FLAGS_NAME_CACHE_MAX 3
+#include <magic_enum/magic_enum.hpp>
+#include <magic_enum/magic_enum_flags.hpp>
+
+#if __has_include(<fmt/format.h>)
+#  define FMT_HEADER_ONLY
+#  include <fmt/format.h>
+#  define MAGIC_ENUM_TEST_HAS_FMT
+#endif
+
+#include <magic_enum/magic_enum_format.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+enum class Color : std::uint8_t { RED = 1, GREEN = 2, BLUE = 4 };
+template <>
+struct magic_enum::customize::enum_range<Color> {
+  static constexpr bool is_flags = true;
+};
+
+// More flags than MAGIC_ENUM_FLAGS_NAME_CACHE_MAX, so names are formatted by bit scan.
+enum class Wide : std::uint8_t { A = 1, B = 2, C = 4, D = 8 };
+template <>
+struct magic_enum::customize::enum_range<Wide> {
+  static constexpr bool is_flags = true;
+};
+
+using namespace magic_enum;
+using namespace magic_enum::bitwise_operators;
+
+TEST_CASE("enum_flags_name_view") {
+  static_assert(detail::has_flags_name_cache_v<Color, as_flags<>>);
+  static_assert(!detail::has_flags_name_cache_v<Wide, as_flags<>>);
+
+  constexpr auto cr = enum_flags_name_view(Color::RED);
+  REQUIRE(cr == "RED");
+  REQUIRE(enum_flags_name_view(Color::GREEN | Color::BLUE) == "GREEN|BLUE");
+  REQUIRE(enum_flags_name_view(Color::RED | Color::GREEN | Color::BLUE) == "RED|GREEN|BLUE");
+  REQUIRE(enum_flags_name_view(Color::RED | Color{8}).empty());
+  REQUIRE(enum_flags_name_view(static_cast<Color>(0)).empty());
+}
+
+TEST_CASE("flags name cache matches bit scan") {
+  std::array<char, enum_flags_name_max_size<Color>()> buffer = {};
+  for (std::uint8_t m = 1; m < 8; ++m) {
+    const auto value = static_cast<Color>(m);
+    const auto view = enum_flags_name_view(value);
+    REQUIRE(enum_flags_name(value) == view);
+    REQUIRE(std::string_view{buffer.data(), enum_flags_name_to(buffer, value)} == view);
+    REQUIRE(enum_flags_cast<Color>(view) == value);
+    REQUIRE(enum_flags_name(value, ',').find('|') == std::string::npos);
+  }
+  REQUIRE(enum_flags_name(Color::RED | Color{8}).empty());
+  REQUIRE(enum_flags_name(Wide::A | Wide::D) == "A|D");
+}
+
+#if defined(MAGIC_ENUM_TEST_HAS_FMT)
+
+TEST_CASE("format-fmt flags name cache") {
+  REQUIRE(fmt::format("{}", Color::RED | Color::BLUE) == "RED|BLUE");
+  REQUIRE(fmt::format("{:f|}", Color::RED | Color::BLUE) == "RED|BLUE");
+  REQUIRE(fmt::format("{:f,}", Color::RED | Color::BLUE) == "RED,BLUE");
+  REQUIRE(fmt::format("{:~^10}", Color::GREEN | Color::BLUE) == "GREEN|BLUE");
+  REQUIRE(fmt::format("{:>3}", Color{8}) == "  8");
+  REQUIRE(fmt::format("{}", Wide::B | Wide::C) == "B|C");
+}
+
+#endif
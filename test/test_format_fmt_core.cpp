@@ -0,0 +1,44 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 - 2026 Daniil Goncharov <neargye@gmail.com>.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+// Only core API of fmt, linked against fmt library, so formatter must not need fmt/format.h.
+#if __has_include(<fmt/base.h>)
+#  include <fmt/base.h>
+#else
+#  include <fmt/core.h>
+#endif
+#include <magic_enum/magic_enum_format.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+
+enum class Color { RED = -12, GREEN = 7, BLUE = 15 };
+
+// Returns offset where formatter stopped parsing spec.
+std::size_t parse_spec(std::string_view spec) {
+  fmt::formatter<Color> formatter;
+  fmt::format_parse_context ctx{fmt::string_view{spec.data(), spec.size()}};
+  return static_cast<std::size_t>(formatter.parse(ctx) - spec.data());
+}
+
+TEST_CASE("format-fmt-core") {
+  REQUIRE(parse_spec("}") == 0);
+  REQUIRE(parse_spec("d}") == 1);
+  REQUIRE(parse_spec("*^5d}") == 4);
+  REQUIRE(parse_spec("f,}") == 2);
+  REQUIRE(parse_spec("<f<}") == 3);
+  REQUIRE(parse_spec(">14t}") == 4);
+  REQUIRE(parse_spec(".2}") == 2);
+  // fmt::format_error is declared in fmt/format.h, it derives from std::runtime_error.
+  REQUIRE_THROWS_AS(static_cast<void>(parse_spec(".2d}")), std::runtime_error);
+  REQUIRE_THROWS_AS(static_cast<void>(parse_spec(".1x}")), std::runtime_error);
+  REQUIRE_THROWS_AS(static_cast<void>(parse_spec(">{}d}")), std::runtime_error);
+
+  // Checked at compile time where fmt supports consteval format strings.
+  [[maybe_unused]] const fmt::format_string<Color> checked{"{:*>5f,}"};
+}
@@ -0,0 +1,83 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2019 - 2026 Daniil Goncharov <neargye@gmail.com>.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#define MAGIC_ENUM_USING_ALIAS_STRING_VIEW using string_view = std::wstring_view;
+#define MAGIC_ENUM_USING_ALIAS_STRING      using string      = std::wstring;
+#define MAGIC_ENUM_NAMES_POOL
+#include <magic_enum/magic_enum.hpp>
+#include <magic_enum/magic_enum_flags.hpp>
+#include <magic_enum/magic_enum_iostream.hpp>
+
+#include "test_helpers.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+enum class Color { RED = -12, GREEN = 7, BLUE = 15 };
+template <>
+constexpr magic_enum::customize::customize_t magic_enum::customize::enum_name<Color>(Color value) noexcept {
+  switch (value) {
+    case Color::RED:
+      return L"red";
+    default:
+      return default_tag;
+  }
+}
+
+enum class Flags : std::uint8_t { A = 1, BB = 2, CCC = 4 };
+template <>
+struct magic_enum::customize::enum_range<Flags> {
+  static constexpr bool is_flags = true;
+};
+
+// Names of more than 255 characters in total need wider offsets.
+enum class LongNames {
+  aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa,
+  bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb,
+  cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc,
+};
+
+using namespace magic_enum;
+using namespace magic_enum::bitwise_operators;
+using namespace magic_enum_tests;
+
+TEST_CASE("names pool") {
+  constexpr auto& pool = detail::names_pool_v<Color, detail::enum_subtype::common>;
+  REQUIRE(std::is_same_v<decltype(pool.offsets[0]), const std::uint8_t&>);
+  REQUIRE(pool.size == sizeof(L"red GREEN BLUE") / sizeof(wchar_t));
+  REQUIRE(std::wstring_view{pool.pool, pool.size - 1} == std::wstring_view{L"red\0GREEN\0BLUE", pool.size - 1});
+
+  REQUIRE(enum_name(Color::GREEN).data() == pool.pool + 4);
+  REQUIRE(enum_names<Color>()[2].data() == pool.pool + 10);
+  REQUIRE(enum_entries<Color>()[0].second.data() == pool.pool);
+  REQUIRE(enum_cast<Color>(L"BLUE") == Color::BLUE);
+  REQUIRE(enum_cast<Color>(L"blue", case_insensitive) == Color::BLUE);
+  REQUIRE_FALSE(enum_cast<Color>(L"RED").has_value());
+
+  require_null_terminated(enum_name(Color::RED), L"red");
+  require_null_terminated(enum_name<Color::BLUE>(), L"BLUE");
+  for (std::wstring_view name : enum_names<Color>()) {
+    require_null_terminated(name);
+  }
+}
+
+TEST_CASE("names pool wide offsets") {
+  constexpr auto& pool = detail::names_pool_v<LongNames, detail::enum_subtype::common>;
+  REQUIRE(std::is_same_v<decltype(pool.offsets[0]), const std::uint16_t&>);
+  REQUIRE(pool.size == 303);
+  REQUIRE(enum_name(LongNames::cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc).data() == pool.pool + 202);
+  REQUIRE(enum_cast<LongNames>(enum_names<LongNames>()[1]) == LongNames::bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb);
+  require_null_terminated(enum_names<LongNames>()[2]);
+}
+
+TEST_CASE("names pool flags") {
+  REQUIRE(enum_flags_name(Flags::A | Flags::CCC) == L"A|CCC");
+  REQUIRE(enum_flags_name(Flags::BB | Flags::CCC, L',') == L"BB,CCC");
+  REQUIRE(enum_flags_cast<Flags>(L"CCC|A") == (Flags::A | Flags::CCC));
+  REQUIRE(enum_name(Flags::BB) == L"BB");
+}